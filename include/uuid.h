@@ -1,6 +1,7 @@
 #ifndef STDUUID_H
 #define STDUUID_H
 
+#include <cassert>
 #include <cstring>
 #include <string>
 #include <sstream>
@@ -16,6 +17,12 @@
 #include <chrono>
 #include <numeric>
 #include <atomic>
+#include <algorithm>
+#include <system_error>
+
+#ifdef UUID_PARALLEL_ALGORITHMS
+#include <execution>
+#endif
 
 #ifdef __cplusplus
 
@@ -28,6 +35,10 @@
 
 #ifdef LIBUUID_CPP20_OR_GREATER
 #include <span>
+#include <compare>
+#  if __has_include(<format>)
+#    include <format>
+#  endif
 #else
 #include <gsl/span>
 #endif
@@ -69,32 +80,44 @@ namespace uuids
 #ifdef __cpp_lib_span
    template <class ElementType, std::size_t Extent>
    using span = std::span<ElementType, Extent>;
+
+   inline constexpr std::size_t dynamic_extent = std::dynamic_extent;
 #else
    template <class ElementType, std::ptrdiff_t Extent>
    using span = gsl::span<ElementType, Extent>;
+
+   inline constexpr std::ptrdiff_t dynamic_extent = gsl::dynamic_extent;
 #endif
 
    namespace detail
    {
-      template <typename TChar>
-      [[nodiscard]] constexpr inline unsigned char hex2char(TChar const ch) noexcept
+      [[nodiscard]] constexpr std::array<unsigned char, 256> make_hex_table() noexcept
       {
-         if (ch >= static_cast<TChar>('0') && ch <= static_cast<TChar>('9'))
-            return static_cast<unsigned char>(ch - static_cast<TChar>('0'));
-         if (ch >= static_cast<TChar>('a') && ch <= static_cast<TChar>('f'))
-            return static_cast<unsigned char>(10 + ch - static_cast<TChar>('a'));
-         if (ch >= static_cast<TChar>('A') && ch <= static_cast<TChar>('F'))
-            return static_cast<unsigned char>(10 + ch - static_cast<TChar>('A'));
-         return 0;
+         std::array<unsigned char, 256> table{};
+         for (size_t i = 0; i < table.size(); ++i)
+            table[i] = 0xFF;
+         for (unsigned char i = 0; i < 10; ++i)
+            table['0' + i] = i;
+         for (unsigned char i = 0; i < 6; ++i)
+         {
+            table['a' + i] = static_cast<unsigned char>(10 + i);
+            table['A' + i] = static_cast<unsigned char>(10 + i);
+         }
+         return table;
       }
 
+      // the value of every hex digit, indexed by its character code, and 0xFF for all other characters
+      inline constexpr std::array<unsigned char, 256> hex_table = make_hex_table();
+
+      // returns the value of a hex digit, or a value greater than 0x0F if the character is not a hex digit
       template <typename TChar>
-      [[nodiscard]] constexpr inline bool is_hex(TChar const ch) noexcept
+      [[nodiscard]] constexpr inline unsigned char hex_value(TChar const ch) noexcept
       {
-         return
-            (ch >= static_cast<TChar>('0') && ch <= static_cast<TChar>('9')) ||
-            (ch >= static_cast<TChar>('a') && ch <= static_cast<TChar>('f')) ||
-            (ch >= static_cast<TChar>('A') && ch <= static_cast<TChar>('F'));
+         auto const code = static_cast<std::make_unsigned_t<TChar>>(ch);
+         if constexpr (sizeof(TChar) == 1)
+            return hex_table[code];
+         else
+            return code < 256 ? hex_table[code] : 0xFF;
       }
 
       template <typename TChar>
@@ -114,6 +137,97 @@ namespace uuids
          return str;
       }
 
+      // positions of the 16 hex digit pairs in the canonical xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx form
+      inline constexpr size_t canonical_offsets[16] = { 0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34 };
+
+      // returns the 36 characters of the canonical form if the string has exactly that layout,
+      // optionally enclosed in braces, or an empty view otherwise
+      template <typename TChar, typename Traits>
+      [[nodiscard]] constexpr std::basic_string_view<TChar, Traits> canonical_body(std::basic_string_view<TChar, Traits> const str) noexcept
+      {
+         size_t hasBraces = 0;
+         if (str.size() == 38 && str.front() == '{' && str.back() == '}')
+            hasBraces = 1;
+         else if (str.size() != 36)
+            return {};
+
+         if (str[hasBraces + 8] != '-' || str[hasBraces + 13] != '-' ||
+             str[hasBraces + 18] != '-' || str[hasBraces + 23] != '-')
+            return {};
+
+         return str.substr(hasBraces, 36);
+      }
+
+      // positions of the 16 hex digit pairs in the compact xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx form
+      inline constexpr size_t compact_offsets[16] = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30 };
+
+      // decodes the hex digit pairs found at fixed offsets, so the loop has no data-dependent branches
+      template <typename TChar>
+      [[nodiscard]] constexpr bool decode_digits(TChar const * str, size_t const (&offsets)[16], std::array<uint8_t, 16> & data) noexcept
+      {
+         if constexpr (sizeof(TChar) > 1)
+         {
+            // narrow wide characters in one pass, checking once that they were all ASCII,
+            // and decode them with the single byte table
+            char narrow[36]{};
+            uint32_t high = 0;
+            for (size_t i = 0; i < offsets[15] + 2; ++i)
+            {
+               auto const code = static_cast<uint32_t>(static_cast<std::make_unsigned_t<TChar>>(str[i]));
+               high |= code;
+               narrow[i] = static_cast<char>(code);
+            }
+            return high <= 0x7F && decode_digits(narrow, offsets, data);
+         }
+
+         unsigned char invalid = 0;
+         for (size_t i = 0; i < 16; ++i)
+         {
+            unsigned char const hi = hex_value(str[offsets[i]]);
+            unsigned char const lo = hex_value(str[offsets[i] + 1]);
+            invalid |= hi | lo;
+            data[i] = static_cast<uint8_t>(hi << 4 | lo);
+         }
+         return invalid <= 0x0F;
+      }
+
+      // loads 8 octets in the byte order of the platform
+      [[nodiscard]] inline uint64_t load64(uint8_t const * p) noexcept
+      {
+         uint64_t value;
+         std::memcpy(&value, p, sizeof(value));
+         return value;
+      }
+
+      // loads 8 octets as a big-endian number, so that numbers compare like the octet sequences; compilers turn this
+      // into a single load followed by a byte swap on little-endian platforms
+      [[nodiscard]] constexpr uint64_t load64_be(uint8_t const * p) noexcept
+      {
+         return
+            static_cast<uint64_t>(p[0]) << 56 |
+            static_cast<uint64_t>(p[1]) << 48 |
+            static_cast<uint64_t>(p[2]) << 40 |
+            static_cast<uint64_t>(p[3]) << 32 |
+            static_cast<uint64_t>(p[4]) << 24 |
+            static_cast<uint64_t>(p[5]) << 16 |
+            static_cast<uint64_t>(p[6]) <<  8 |
+            static_cast<uint64_t>(p[7]);
+      }
+
+      // loads 8 octets as a little-endian number, independently of the byte order of the platform
+      [[nodiscard]] constexpr uint64_t load64_le(uint8_t const * p) noexcept
+      {
+         return
+            static_cast<uint64_t>(p[0])       |
+            static_cast<uint64_t>(p[1]) <<  8 |
+            static_cast<uint64_t>(p[2]) << 16 |
+            static_cast<uint64_t>(p[3]) << 24 |
+            static_cast<uint64_t>(p[4]) << 32 |
+            static_cast<uint64_t>(p[5]) << 40 |
+            static_cast<uint64_t>(p[6]) << 48 |
+            static_cast<uint64_t>(p[7]) << 56;
+      }
+
       class sha1
       {
       public:
@@ -300,11 +414,50 @@ namespace uuids
       template <>
       inline constexpr wchar_t empty_guid<wchar_t>[37] = L"00000000-0000-0000-0000-000000000000";
 
+      template <>
+      inline constexpr char16_t empty_guid<char16_t>[37] = u"00000000-0000-0000-0000-000000000000";
+
+      template <>
+      inline constexpr char32_t empty_guid<char32_t>[37] = U"00000000-0000-0000-0000-000000000000";
+
+#ifdef __cpp_char8_t
+      template <>
+      inline constexpr char8_t empty_guid<char8_t>[37] = u8"00000000-0000-0000-0000-000000000000";
+#endif
+
       template <typename CharT>
       inline constexpr CharT guid_encoder[17] = "0123456789abcdef";
 
       template <>
       inline constexpr wchar_t guid_encoder<wchar_t>[17] = L"0123456789abcdef";
+
+      template <>
+      inline constexpr char16_t guid_encoder<char16_t>[17] = u"0123456789abcdef";
+
+      template <>
+      inline constexpr char32_t guid_encoder<char32_t>[17] = U"0123456789abcdef";
+
+#ifdef __cpp_char8_t
+      template <>
+      inline constexpr char8_t guid_encoder<char8_t>[17] = u8"0123456789abcdef";
+#endif
+
+      template <typename CharT>
+      inline constexpr CharT guid_encoder_upper[17] = "0123456789ABCDEF";
+
+      template <>
+      inline constexpr wchar_t guid_encoder_upper<wchar_t>[17] = L"0123456789ABCDEF";
+
+      template <>
+      inline constexpr char16_t guid_encoder_upper<char16_t>[17] = u"0123456789ABCDEF";
+
+      template <>
+      inline constexpr char32_t guid_encoder_upper<char32_t>[17] = U"0123456789ABCDEF";
+
+#ifdef __cpp_char8_t
+      template <>
+      inline constexpr char8_t guid_encoder_upper<char8_t>[17] = u8"0123456789ABCDEF";
+#endif
    }
 
    // --------------------------------------------------------------------------------------------------------------------------
@@ -375,13 +528,266 @@ namespace uuids
       name_based_sha1 = 5   // The name-based version specified in RFS 4122 with SHA1 hashing
    };
 
-   // Forward declare uuid & to_string so that we can declare to_string as a friend later.
+   // the textual representations of a uuid
+   enum class uuid_format
+   {
+      canonical,  // xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+      braced,     // {xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}
+      compact,    // xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+      urn         // urn:uuid:xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+   };
+
+   // the letter case of the hex digits a-f in the textual representation of a uuid
+   enum class uuid_case
+   {
+      lower,
+      upper
+   };
+
+   namespace detail
+   {
+      // classifies a string only by its length and first character; the content is not validated
+      template <typename TChar, typename Traits>
+      [[nodiscard]] constexpr std::optional<uuid_format> detect_format(std::basic_string_view<TChar, Traits> const str) noexcept
+      {
+         switch (str.size())
+         {
+         case 32: return uuid_format::compact;
+         case 36: return uuid_format::canonical;
+         case 38: if (str.front() == '{') return uuid_format::braced; break;
+         case 45: if (str.front() == 'u' || str.front() == 'U') return uuid_format::urn; break;
+         }
+         return {};
+      }
+
+      [[nodiscard]] constexpr size_t format_size(uuid_format const format) noexcept
+      {
+         switch (format)
+         {
+         case uuid_format::braced: return 38;
+         case uuid_format::compact: return 32;
+         case uuid_format::urn: return 45;
+         default: return 36;
+         }
+      }
+
+      template <typename CharT, uuid_case Case>
+      [[nodiscard]] constexpr std::array<CharT, 512> make_hex_pairs() noexcept
+      {
+         CharT const * encoder = Case == uuid_case::upper ? guid_encoder_upper<CharT> : guid_encoder<CharT>;
+         std::array<CharT, 512> pairs{};
+         for (size_t i = 0; i < 256; ++i)
+         {
+            pairs[2 * i] = encoder[i >> 4];
+            pairs[2 * i + 1] = encoder[i & 0x0f];
+         }
+         return pairs;
+      }
+
+      // the two hex digits of every octet, at twice the value of the octet
+      template <typename CharT, uuid_case Case>
+      inline constexpr std::array<CharT, 512> hex_pairs = make_hex_pairs<CharT, Case>();
+
+      // the octets that begin each of the five hyphen-separated groups of the canonical form, and the end
+      inline constexpr size_t group_offsets[6] = { 0, 4, 6, 8, 10, 16 };
+
+      // writes the textual representation of the 16 octets at out, which must have room for format_size(Format)
+      // characters, and returns the position past the last character written; the format and letter case are known at
+      // compile time, so this is a straight sequence of table lookups and stores
+      template <uuid_format Format, uuid_case Case, typename CharT>
+      constexpr CharT * encode_as(CharT * out, std::array<uint8_t, 16> const & data) noexcept
+      {
+         auto const & pairs = hex_pairs<CharT, Case>;
+
+         if constexpr (Format == uuid_format::braced)
+         {
+            *out++ = static_cast<CharT>('{');
+         }
+         else if constexpr (Format == uuid_format::urn)
+         {
+            for (char const c : { 'u', 'r', 'n', ':', 'u', 'u', 'i', 'd', ':' })
+               *out++ = static_cast<CharT>(c);
+         }
+
+         // one table lookup per octet, with the hyphens at fixed positions instead of tested for every octet
+         for (size_t group = 0; group < 5; ++group)
+         {
+            if constexpr (Format != uuid_format::compact)
+            {
+               if (group > 0)
+                  *out++ = static_cast<CharT>('-');
+            }
+
+            for (size_t i = group_offsets[group]; i < group_offsets[group + 1]; ++i)
+            {
+               out[0] = pairs[2 * data[i]];
+               out[1] = pairs[2 * data[i] + 1];
+               out += 2;
+            }
+         }
+
+         if constexpr (Format == uuid_format::braced)
+            *out++ = static_cast<CharT>('}');
+
+         return out;
+      }
+
+      template <uuid_case Case, typename CharT>
+      constexpr CharT * encode(CharT * out, std::array<uint8_t, 16> const & data, uuid_format const format) noexcept
+      {
+         switch (format)
+         {
+         case uuid_format::braced: return encode_as<uuid_format::braced, Case>(out, data);
+         case uuid_format::compact: return encode_as<uuid_format::compact, Case>(out, data);
+         case uuid_format::urn: return encode_as<uuid_format::urn, Case>(out, data);
+         default: return encode_as<uuid_format::canonical, Case>(out, data);
+         }
+      }
+
+      // same as encode_as, choosing the format and letter case once at run time
+      template <typename CharT>
+      constexpr CharT * encode(CharT * out, std::array<uint8_t, 16> const & data, uuid_format const format, uuid_case const letter_case) noexcept
+      {
+         return letter_case == uuid_case::upper ?
+            encode<uuid_case::upper>(out, data, format) :
+            encode<uuid_case::lower>(out, data, format);
+      }
+
+      template <typename TChar, typename Traits>
+      [[nodiscard]] constexpr bool has_urn_prefix(std::basic_string_view<TChar, Traits> const str) noexcept
+      {
+         constexpr char lower[] = "urn:uuid:";
+         constexpr char upper[] = "URN:UUID:";
+         if (str.size() < 9) return false;
+         for (size_t i = 0; i < 9; ++i)
+         {
+            if (str[i] != static_cast<TChar>(lower[i]) && str[i] != static_cast<TChar>(upper[i]))
+               return false;
+         }
+         return true;
+      }
+
+      // parses a uuid in any of the uuid_format forms, or in any form where the 32 hex digits are separated
+      // by arbitrary hyphens, optionally enclosed in braces
+      template <typename TChar, typename Traits>
+      [[nodiscard]] constexpr bool parse_uuid(std::basic_string_view<TChar, Traits> const str, std::array<uint8_t, 16> & data) noexcept
+      {
+         auto const format = detect_format(str);
+         if (format == uuid_format::compact)
+            return decode_digits(str.data(), compact_offsets, data);
+         if (format == uuid_format::urn)
+         {
+            auto body = canonical_body(str.substr(9));
+            return has_urn_prefix(str) && !body.empty() && decode_digits(body.data(), canonical_offsets, data);
+         }
+
+         if (auto body = canonical_body(str); !body.empty())
+            return decode_digits(body.data(), canonical_offsets, data);
+
+         bool firstDigit = true;
+         size_t hasBraces = 0;
+         size_t index = 0;
+
+         if (str.empty()) return false;
+
+         if (str.front() == '{')
+            hasBraces = 1;
+         if (hasBraces && str.back() != '}')
+            return false;
+
+         for (size_t i = hasBraces; i < str.size() - hasBraces; ++i)
+         {
+            if (str[i] == '-') continue;
+
+            unsigned char const value = hex_value(str[i]);
+            if (index >= 16 || value > 0x0F)
+            {
+               return false;
+            }
+
+            if (firstDigit)
+            {
+               data[index] = static_cast<uint8_t>(value << 4);
+               firstDigit = false;
+            }
+            else
+            {
+               data[index] = static_cast<uint8_t>(data[index] | value);
+               index++;
+               firstDigit = true;
+            }
+         }
+
+         return index == 16;
+      }
+
+   }
+
+   // A compile-time choice of textual representation, used as a template argument of to_chars and to_fixed_string
+   // so that the encoder is specialized for it.
+   template <uuid_format Format = uuid_format::canonical, uuid_case Case = uuid_case::lower>
+   struct uuid_format_policy
+   {
+      static constexpr uuid_format format = Format;
+      static constexpr uuid_case letter_case = Case;
+      static constexpr size_t size = detail::format_size(Format);
+   };
+
+   // lower case, hyphen-separated, as recommended by RFC 4122
+   using rfc_format = uuid_format_policy<uuid_format::canonical, uuid_case::lower>;
+
+   // upper case and enclosed in braces, as found in the Windows registry
+   using registry_format = uuid_format_policy<uuid_format::braced, uuid_case::upper>;
+
+   template <typename T>
+   struct is_uuid_format_policy : std::false_type {};
+
+   template <uuid_format Format, uuid_case Case>
+   struct is_uuid_format_policy<uuid_format_policy<Format, Case>> : std::true_type {};
+
+   template <typename T>
+   inline constexpr bool is_uuid_format_policy_v = is_uuid_format_policy<T>::value;
+
+   // Returns the format of a uuid string, judging only by its length and first character.
+   // The string may still be invalid if a format is returned.
+   template <typename StringType>
+   [[nodiscard]] constexpr std::optional<uuid_format> detect_format(StringType const & str) noexcept
+   {
+      return detail::detect_format(detail::to_string_view(str));
+   }
+
+   template <typename CharT>
+   struct from_chars_result
+   {
+      CharT const * ptr;
+      std::errc ec;
+   };
+
+   template <typename CharT>
+   struct to_chars_result
+   {
+      CharT * ptr;
+      std::errc ec;
+   };
+
+   // Forward declare uuid, to_string, to_chars & uuid_bytes so that we can declare them as friends later.
    class uuid;
+
+   namespace detail
+   {
+      [[nodiscard]] constexpr std::array<uint8_t, 16> const & uuid_bytes(uuid const & id) noexcept;
+   }
+
    template <class CharT = char,
              class Traits = std::char_traits<CharT>,
              class Allocator = std::allocator<CharT>>
    std::basic_string<CharT, Traits, Allocator> to_string(uuid const &id);
 
+   template <typename CharT>
+   constexpr to_chars_result<CharT> to_chars(CharT * first, CharT * last, uuid const & id,
+                                             uuid_format format = uuid_format::canonical,
+                                             uuid_case letter_case = uuid_case::lower) noexcept;
+
    // --------------------------------------------------------------------------------------------------------------------------
    // uuid class
    // --------------------------------------------------------------------------------------------------------------------------
@@ -392,9 +798,10 @@ namespace uuids
 
       constexpr uuid() noexcept = default;
 
-      uuid(value_type(&arr)[16]) noexcept
+      constexpr uuid(value_type const (&arr)[16]) noexcept
       {
-         std::copy(std::cbegin(arr), std::cend(arr), std::begin(data));
+         for (size_t i = 0; i < 16; ++i)
+            data[i] = arr[i];
       }
 
       constexpr uuid(std::array<value_type, 16> const & arr) noexcept : data{arr} {}
@@ -458,99 +865,49 @@ namespace uuids
       template <typename StringType>
       [[nodiscard]] constexpr static bool is_valid_uuid(StringType const & in_str) noexcept
       {
-         auto str = detail::to_string_view(in_str);
-         bool firstDigit = true;
-         size_t hasBraces = 0;
-         size_t index = 0;
-
-         if (str.empty())
-            return false;
-
-         if (str.front() == '{')
-            hasBraces = 1;
-         if (hasBraces && str.back() != '}')
-            return false;
-
-         for (size_t i = hasBraces; i < str.size() - hasBraces; ++i)
-         {
-            if (str[i] == '-') continue;
-
-            if (index >= 16 || !detail::is_hex(str[i]))
-            {
-               return false;
-            }
-
-            if (firstDigit)
-            {
-               firstDigit = false;
-            }
-            else
-            {
-               index++;
-               firstDigit = true;
-            }
-         }
-
-         if (index < 16)
-         {
-            return false;
-         }
-
-         return true;
+         std::array<uint8_t, 16> data{ { 0 } };
+         return detail::parse_uuid(detail::to_string_view(in_str), data);
       }
 
       template <typename StringType>
       [[nodiscard]] constexpr static std::optional<uuid> from_string(StringType const & in_str) noexcept
       {
-         auto str = detail::to_string_view(in_str);
-         bool firstDigit = true;
-         size_t hasBraces = 0;
-         size_t index = 0;
-
          std::array<uint8_t, 16> data{ { 0 } };
+         if (!detail::parse_uuid(detail::to_string_view(in_str), data))
+            return {};
 
-         if (str.empty()) return {};
+         return uuid{ data };
+      }
 
-         if (str.front() == '{')
-            hasBraces = 1;
-         if (hasBraces && str.back() != '}')
+      // accepts only the canonical form xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx, optionally enclosed in braces
+      template <typename StringType>
+      [[nodiscard]] constexpr static bool is_valid_uuid_strict(StringType const & in_str) noexcept
+      {
+         std::array<uint8_t, 16> data{ { 0 } };
+         auto body = detail::canonical_body(detail::to_string_view(in_str));
+         return !body.empty() && detail::decode_digits(body.data(), detail::canonical_offsets, data);
+      }
+
+      // accepts only the canonical form xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx, optionally enclosed in braces
+      template <typename StringType>
+      [[nodiscard]] constexpr static std::optional<uuid> from_string_strict(StringType const & in_str) noexcept
+      {
+         std::array<uint8_t, 16> data{ { 0 } };
+         auto body = detail::canonical_body(detail::to_string_view(in_str));
+         if (body.empty() || !detail::decode_digits(body.data(), detail::canonical_offsets, data))
             return {};
 
-         for (size_t i = hasBraces; i < str.size() - hasBraces; ++i)
-         {
-            if (str[i] == '-') continue;
+         return uuid{ data };
+      }
 
-            if (index >= 16 || !detail::is_hex(str[i]))
-            {
-               return {};
-            }
-
-            if (firstDigit)
-            {
-               data[index] = static_cast<uint8_t>(detail::hex2char(str[i]) << 4);
-               firstDigit = false;
-            }
-            else
-            {
-               data[index] = static_cast<uint8_t>(data[index] | detail::hex2char(str[i]));
-               index++;
-               firstDigit = true;
-            }
-         }
-
-         if (index < 16)
-         {
-            return {};
-         }
-
-         return uuid{ data };
-      }
-
-   private:
-      std::array<value_type, 16> data{ { 0 } };
+   private:
+      std::array<value_type, 16> data{ { 0 } };
 
       friend bool operator==(uuid const & lhs, uuid const & rhs) noexcept;
       friend bool operator<(uuid const & lhs, uuid const & rhs) noexcept;
+#ifdef __cpp_lib_three_way_comparison
+      friend std::strong_ordering operator<=>(uuid const & lhs, uuid const & rhs) noexcept;
+#endif
 
       template <class Elem, class Traits>
       friend std::basic_ostream<Elem, Traits> & operator<<(std::basic_ostream<Elem, Traits> &s, uuid const & id);
@@ -558,16 +915,33 @@ namespace uuids
       template<class CharT, class Traits, class Allocator>
       friend std::basic_string<CharT, Traits, Allocator> to_string(uuid const& id);
 
+      template <typename CharT>
+      friend constexpr to_chars_result<CharT> to_chars(CharT * first, CharT * last, uuid const & id,
+                                                       uuid_format format, uuid_case letter_case) noexcept;
+
+      friend constexpr std::array<value_type, 16> const & detail::uuid_bytes(uuid const & id) noexcept;
+
       friend std::hash<uuid>;
    };
 
+   namespace detail
+   {
+      [[nodiscard]] constexpr std::array<uint8_t, 16> const & uuid_bytes(uuid const & id) noexcept
+      {
+         return id.data;
+      }
+   }
+
    // --------------------------------------------------------------------------------------------------------------------------
    // operators and non-member functions
    // --------------------------------------------------------------------------------------------------------------------------
 
+   // compares the two halves as 64-bit words instead of octet by octet
    [[nodiscard]] inline bool operator== (uuid const& lhs, uuid const& rhs) noexcept
    {
-      return lhs.data == rhs.data;
+      auto const l = lhs.data.data();
+      auto const r = rhs.data.data();
+      return ((detail::load64(l) ^ detail::load64(r)) | (detail::load64(l + 8) ^ detail::load64(r + 8))) == 0;
    }
 
    [[nodiscard]] inline bool operator!= (uuid const& lhs, uuid const& rhs) noexcept
@@ -575,10 +949,24 @@ namespace uuids
       return !(lhs == rhs);
    }
 
+   // orders like a lexicographical comparison of the octets, with two comparisons of big-endian 64-bit words
    [[nodiscard]] inline bool operator< (uuid const& lhs, uuid const& rhs) noexcept
    {
-      return lhs.data < rhs.data;
+      auto const lhi = detail::load64_be(lhs.data.data());
+      auto const rhi = detail::load64_be(rhs.data.data());
+      return lhi < rhi || (lhi == rhi && detail::load64_be(lhs.data.data() + 8) < detail::load64_be(rhs.data.data() + 8));
+   }
+
+#ifdef __cpp_lib_three_way_comparison
+   [[nodiscard]] inline std::strong_ordering operator<=> (uuid const& lhs, uuid const& rhs) noexcept
+   {
+      auto const lhi = detail::load64_be(lhs.data.data());
+      auto const rhi = detail::load64_be(rhs.data.data());
+      if (lhi != rhi)
+         return lhi <=> rhi;
+      return detail::load64_be(lhs.data.data() + 8) <=> detail::load64_be(rhs.data.data() + 8);
    }
+#endif
 
    template <class CharT,
              class Traits,
@@ -586,26 +974,256 @@ namespace uuids
    [[nodiscard]] inline std::basic_string<CharT, Traits, Allocator> to_string(uuid const & id)
    {
       std::basic_string<CharT, Traits, Allocator> uustr{detail::empty_guid<CharT>};
+      detail::encode(uustr.data(), id.data, uuid_format::canonical, uuid_case::lower);
+      return uustr;
+   }
+
+   // Writes the textual representation of id to [first, last), without a terminating null character. On success,
+   // ptr points past the last character written. If the range is too small, ptr is last, ec is
+   // std::errc::value_too_large and nothing is written.
+   template <typename CharT>
+   constexpr to_chars_result<CharT> to_chars(CharT * first, CharT * last, uuid const & id,
+                                             uuid_format const format, uuid_case const letter_case) noexcept
+   {
+      if (static_cast<size_t>(last - first) < detail::format_size(format))
+         return { last, std::errc::value_too_large };
+
+      return { detail::encode(first, id.data, format, letter_case), std::errc{} };
+   }
+
+   // A fixed-capacity string holding exactly N characters, followed by a null character, in inline storage.
+   // It is returned by to_fixed_string for callers that need the textual form of a uuid without allocating.
+   template <typename CharT, size_t N = 36>
+   class uuid_string
+   {
+   public:
+      using value_type     = CharT;
+      using size_type      = size_t;
+      using iterator       = CharT *;
+      using const_iterator = CharT const *;
+
+      constexpr uuid_string() noexcept = default;
+
+      [[nodiscard]] constexpr CharT * data() noexcept { return m_chars; }
+      [[nodiscard]] constexpr CharT const * data() const noexcept { return m_chars; }
+      [[nodiscard]] constexpr CharT const * c_str() const noexcept { return m_chars; }
+
+      [[nodiscard]] constexpr size_type size() const noexcept { return N; }
+      [[nodiscard]] constexpr size_type length() const noexcept { return N; }
+
+      [[nodiscard]] constexpr iterator begin() noexcept { return m_chars; }
+      [[nodiscard]] constexpr iterator end() noexcept { return m_chars + N; }
+      [[nodiscard]] constexpr const_iterator begin() const noexcept { return m_chars; }
+      [[nodiscard]] constexpr const_iterator end() const noexcept { return m_chars + N; }
+
+      [[nodiscard]] constexpr CharT & operator[](size_type const index) noexcept { return m_chars[index]; }
+      [[nodiscard]] constexpr CharT const & operator[](size_type const index) const noexcept { return m_chars[index]; }
+
+      [[nodiscard]] constexpr std::basic_string_view<CharT> view() const noexcept
+      {
+         return std::basic_string_view<CharT>(m_chars, N);
+      }
+
+      constexpr operator std::basic_string_view<CharT>() const noexcept { return view(); }
+
+      [[nodiscard]] friend constexpr bool operator==(uuid_string const & lhs, uuid_string const & rhs) noexcept
+      {
+         return lhs.view() == rhs.view();
+      }
+
+      [[nodiscard]] friend constexpr bool operator!=(uuid_string const & lhs, uuid_string const & rhs) noexcept
+      {
+         return !(lhs == rhs);
+      }
+
+      template <class Traits>
+      friend std::basic_ostream<CharT, Traits> & operator<<(std::basic_ostream<CharT, Traits> & s, uuid_string const & str)
+      {
+         return s << std::basic_string_view<CharT, Traits>(str.m_chars, N);
+      }
+
+   private:
+      CharT m_chars[N + 1]{};
+   };
 
-      for (size_t i = 0, index = 0; i < 36; ++i)
+   // Returns the canonical textual representation of id in a uuid_string, without allocating.
+   template <typename CharT = char>
+   [[nodiscard]] constexpr std::enable_if_t<!is_uuid_format_policy_v<CharT>, uuid_string<CharT>>
+   to_fixed_string(uuid const & id) noexcept
+   {
+      uuid_string<CharT> str;
+      to_chars(str.data(), str.data() + str.size(), id);
+      return str;
+   }
+
+   // Same as to_chars above, with the format and letter case given by a uuid_format_policy.
+   template <typename Policy, typename CharT>
+   constexpr std::enable_if_t<is_uuid_format_policy_v<Policy>, to_chars_result<CharT>>
+   to_chars(CharT * first, CharT * last, uuid const & id) noexcept
+   {
+      if (static_cast<size_t>(last - first) < Policy::size)
+         return { last, std::errc::value_too_large };
+
+      return { detail::encode_as<Policy::format, Policy::letter_case>(first, detail::uuid_bytes(id)), std::errc{} };
+   }
+
+   // Returns the textual representation of id described by a uuid_format_policy in a uuid_string.
+   template <typename Policy, typename CharT = char>
+   [[nodiscard]] constexpr std::enable_if_t<is_uuid_format_policy_v<Policy>, uuid_string<CharT, Policy::size>>
+   to_fixed_string(uuid const & id) noexcept
+   {
+      uuid_string<CharT, Policy::size> str;
+      detail::encode_as<Policy::format, Policy::letter_case>(str.data(), detail::uuid_bytes(id));
+      return str;
+   }
+
+   namespace detail
+   {
+      // Parses the format specification of a uuid replacement field: an optional 'U' for upper case and at most one
+      // of 'c' (compact), 'b' (braced) or 'r' (urn), in any order. Returns the position of the first character that
+      // was not consumed, which is last or the closing brace if the specification is valid.
+      template <typename Iterator>
+      constexpr Iterator parse_format_spec(Iterator first, Iterator last, uuid_format & format, uuid_case & letter_case) noexcept
       {
-         if (i == 8 || i == 13 || i == 18 || i == 23)
+         bool has_case = false;
+         bool has_format = false;
+         for (; first != last; ++first)
          {
-            continue;
+            if (*first == 'U' && !has_case)
+            {
+               letter_case = uuid_case::upper;
+               has_case = true;
+            }
+            else if ((*first == 'c' || *first == 'b' || *first == 'r') && !has_format)
+            {
+               format = *first == 'c' ? uuid_format::compact :
+                        *first == 'b' ? uuid_format::braced :
+                                        uuid_format::urn;
+               has_format = true;
+            }
+            else
+            {
+               break;
+            }
          }
-         uustr[i] = detail::guid_encoder<CharT>[id.data[index] >> 4 & 0x0f];
-         uustr[++i] = detail::guid_encoder<CharT>[id.data[index] & 0x0f];
-         index++;
+
+         return first;
       }
 
-      return uustr;
+      // Formatter shared by the std::format and fmt specializations, which only differ in the error type.
+      template <typename CharT, typename FormatError>
+      struct basic_uuid_formatter
+      {
+         constexpr basic_uuid_formatter() noexcept = default;
+
+         constexpr basic_uuid_formatter(uuid_format const format, uuid_case const letter_case) noexcept :
+            m_format(format), m_case(letter_case)
+         {
+         }
+
+         template <typename ParseContext>
+         constexpr auto parse(ParseContext & ctx)
+         {
+            auto it = parse_format_spec(ctx.begin(), ctx.end(), m_format, m_case);
+            if (it != ctx.end() && *it != '}')
+               throw FormatError("invalid format specification for uuid");
+            return it;
+         }
+
+         template <typename FormatContext>
+         auto format(uuid const & id, FormatContext & ctx) const
+         {
+            CharT buffer[45];
+            auto result = to_chars(buffer, buffer + 45, id, m_format, m_case);
+            return std::copy(buffer, result.ptr, ctx.out());
+         }
+
+      private:
+         uuid_format m_format = uuid_format::canonical;
+         uuid_case m_case = uuid_case::lower;
+      };
    }
 
+   // Writes the canonical textual representation of a uuid directly to the stream buffer, in upper case if
+   // std::uppercase is set, padded with the fill character up to the stream width.
    template <class Elem, class Traits>
    std::basic_ostream<Elem, Traits>& operator<<(std::basic_ostream<Elem, Traits>& s, uuid const& id)
    {
-       s << to_string(id);
-       return s;
+      typename std::basic_ostream<Elem, Traits>::sentry sentry(s);
+      if (!sentry)
+         return s;
+
+      Elem chars[36];
+      to_chars(chars, chars + 36, id, uuid_format::canonical,
+               (s.flags() & std::ios_base::uppercase) ? uuid_case::upper : uuid_case::lower);
+
+      std::streamsize const padding = s.width() > 36 ? s.width() - 36 : 0;
+      bool const left = (s.flags() & std::ios_base::adjustfield) == std::ios_base::left;
+      auto const sb = s.rdbuf();
+      auto const pad = [&]() {
+         for (std::streamsize i = 0; i < padding; ++i)
+            if (Traits::eq_int_type(sb->sputc(s.fill()), Traits::eof()))
+               return false;
+         return true;
+      };
+
+      bool const ok = (left || pad()) && sb->sputn(chars, 36) == 36 && (!left || pad());
+      s.width(0);
+      if (!ok)
+         s.setstate(std::ios_base::badbit);
+      return s;
+   }
+
+   // Reads a uuid in any of the uuid_format forms, or with hyphens anywhere between the hex digits, directly from the
+   // stream buffer. Extraction stops at the first character that cannot be part of a uuid. Sets failbit, leaving id
+   // unchanged, if the characters read are not a valid uuid.
+   template <class Elem, class Traits>
+   std::basic_istream<Elem, Traits>& operator>>(std::basic_istream<Elem, Traits>& s, uuid& id)
+   {
+      typename std::basic_istream<Elem, Traits>::sentry sentry(s);
+      if (!sentry)
+         return s;
+
+      constexpr char urn_lower[] = "urn:uuid:";
+      constexpr char urn_upper[] = "URN:UUID:";
+
+      Elem chars[45];
+      size_t size = 0;
+      std::ios_base::iostate state = std::ios_base::goodbit;
+      auto const sb = s.rdbuf();
+
+      for (auto ch = sb->sgetc(); ; ch = sb->snextc())
+      {
+         if (Traits::eq_int_type(ch, Traits::eof()))
+         {
+            state |= std::ios_base::eofbit;
+            break;
+         }
+
+         Elem const c = Traits::to_char_type(ch);
+         bool const urn = size > 0 ? (chars[0] == 'u' || chars[0] == 'U') : (c == 'u' || c == 'U');
+         bool const accepted = (urn && size < 9) ?
+            (c == static_cast<Elem>(urn_lower[size]) || c == static_cast<Elem>(urn_upper[size])) :
+            (detail::hex_value(c) <= 0x0F || c == '-' || (size == 0 && c == '{') || (size > 0 && chars[0] == '{' && c == '}'));
+         if (!accepted)
+            break;
+
+         chars[size++] = c;
+         if (c == '}' || size == std::size(chars))
+         {
+            sb->sbumpc();
+            break;
+         }
+      }
+
+      std::array<uint8_t, 16> data{ { 0 } };
+      if (detail::parse_uuid(std::basic_string_view<Elem, Traits>(chars, size), data))
+         id = uuid{ data };
+      else
+         state |= std::ios_base::failbit;
+
+      s.setstate(state);
+      return s;
    }
 
    inline void swap(uuids::uuid & lhs, uuids::uuid & rhs) noexcept
@@ -613,6 +1231,822 @@ namespace uuids
       lhs.swap(rhs);   
    }
 
+   // A copy of the 16 bytes of a uuid, to be passed to a logger or any other sink in place of its text, which is only
+   // produced, in the form described by Policy, if the sink writes it to a stream or formats it.
+   template <typename Policy = rfc_format>
+   class deferred_uuid
+   {
+      static_assert(is_uuid_format_policy_v<Policy>, "Policy must be a uuid_format_policy");
+
+   public:
+      using policy_type = Policy;
+
+      constexpr deferred_uuid() noexcept = default;
+      constexpr explicit deferred_uuid(uuid const & id) noexcept : m_id(id) {}
+
+      [[nodiscard]] constexpr uuid const & id() const noexcept { return m_id; }
+
+      template <typename CharT = char>
+      [[nodiscard]] constexpr uuid_string<CharT, Policy::size> to_fixed_string() const noexcept
+      {
+         return uuids::to_fixed_string<Policy, CharT>(m_id);
+      }
+
+      template <class Elem, class Traits>
+      friend std::basic_ostream<Elem, Traits> & operator<<(std::basic_ostream<Elem, Traits> & s, deferred_uuid const & value)
+      {
+         auto const str = value.template to_fixed_string<Elem>();
+         return s << std::basic_string_view<Elem, Traits>(str.data(), str.size());
+      }
+
+   private:
+      uuid m_id;
+   };
+
+   deferred_uuid(uuid const &) -> deferred_uuid<>;
+
+   namespace detail
+   {
+      // Formats a deferred_uuid in the form of its policy, unless the format specification chooses another.
+      template <typename CharT, typename Policy, typename FormatError>
+      struct deferred_uuid_formatter : basic_uuid_formatter<CharT, FormatError>
+      {
+         constexpr deferred_uuid_formatter() noexcept :
+            basic_uuid_formatter<CharT, FormatError>(Policy::format, Policy::letter_case)
+         {
+         }
+
+         template <typename FormatContext>
+         auto format(deferred_uuid<Policy> const & value, FormatContext & ctx) const
+         {
+            return basic_uuid_formatter<CharT, FormatError>::format(value.id(), ctx);
+         }
+      };
+   }
+
+   // --------------------------------------------------------------------------------------------------------------------------
+   // character sequence conversions
+   // --------------------------------------------------------------------------------------------------------------------------
+
+   // Parses a uuid from the beginning of [first, last), in any of the uuid_format forms. Only the characters
+   // of the uuid are consumed. On success, ptr points
+   // past the last character of the uuid. Otherwise, ptr is first, ec is std::errc::invalid_argument and id is
+   // not modified.
+   template <typename CharT>
+   constexpr from_chars_result<CharT> from_chars(CharT const * first, CharT const * last, uuid & id) noexcept
+   {
+      std::basic_string_view<CharT> const str(first, static_cast<size_t>(last - first));
+      std::array<uint8_t, 16> data{ { 0 } };
+      size_t length = 0;
+
+      if (str.size() >= 38 && str[0] == '{')
+      {
+         auto body = detail::canonical_body(str.substr(0, 38));
+         if (!body.empty() && detail::decode_digits(body.data(), detail::canonical_offsets, data))
+            length = 38;
+      }
+      else if (str.size() >= 45 && (str[0] == 'u' || str[0] == 'U'))
+      {
+         auto body = detail::canonical_body(str.substr(9, 36));
+         if (detail::has_urn_prefix(str) && !body.empty() && detail::decode_digits(body.data(), detail::canonical_offsets, data))
+            length = 45;
+      }
+      else if (str.size() >= 36 && str[8] == '-')
+      {
+         auto body = detail::canonical_body(str.substr(0, 36));
+         if (!body.empty() && detail::decode_digits(body.data(), detail::canonical_offsets, data))
+            length = 36;
+      }
+      else if (str.size() >= 32)
+      {
+         if (detail::decode_digits(first, detail::compact_offsets, data))
+            length = 32;
+      }
+
+      if (length == 0)
+         return { first, std::errc::invalid_argument };
+
+      id = uuid{ data };
+      return { first + length, std::errc{} };
+   }
+
+   // Parses a uuid that arrives in several chunks, such as segmented network buffers, without reassembling them.
+   // The state of the digits seen so far is kept between calls to feed. Hyphens are accepted anywhere and the uuid
+   // may be enclosed in braces; it is complete once 32 hex digits (and the closing brace, if any) have been seen.
+   class uuid_incremental_parser
+   {
+   public:
+      enum class status
+      {
+         incomplete,
+         complete,
+         invalid
+      };
+
+      constexpr uuid_incremental_parser() noexcept = default;
+
+      // Consumes characters from [first, last) until the uuid is complete or an invalid character is found.
+      // Returns the number of characters consumed; the invalid character, if any, is not consumed.
+      template <typename CharT>
+      constexpr size_t feed(CharT const * first, CharT const * last) noexcept
+      {
+         CharT const * current = first;
+         for (; current != last && m_status == status::incomplete; ++current)
+         {
+            CharT const ch = *current;
+            unsigned char const value = detail::hex_value(ch);
+
+            if (m_digits == 32)
+            {
+               if (ch == '}')
+               {
+                  m_status = status::complete;
+               }
+               else if (ch != '-')
+               {
+                  m_status = status::invalid;
+                  break;
+               }
+            }
+            else if (value <= 0x0F)
+            {
+               if (m_digits % 2 == 0)
+                  m_data[m_digits / 2] = static_cast<uint8_t>(value << 4);
+               else
+                  m_data[m_digits / 2] = static_cast<uint8_t>(m_data[m_digits / 2] | value);
+
+               if (++m_digits == 32 && !m_braced)
+                  m_status = status::complete;
+            }
+            else if (ch == '{' && m_consumed == 0)
+            {
+               m_braced = true;
+            }
+            else if (ch != '-')
+            {
+               m_status = status::invalid;
+               break;
+            }
+
+            ++m_consumed;
+         }
+
+         return static_cast<size_t>(current - first);
+      }
+
+      template <typename StringType>
+      constexpr size_t feed(StringType const & chunk) noexcept
+      {
+         auto str = detail::to_string_view(chunk);
+         return feed(str.data(), str.data() + str.size());
+      }
+
+      [[nodiscard]] constexpr status state() const noexcept
+      {
+         return m_status;
+      }
+
+      [[nodiscard]] constexpr std::optional<uuid> result() const noexcept
+      {
+         if (m_status != status::complete)
+            return {};
+         return uuid{ m_data };
+      }
+
+      constexpr void reset() noexcept
+      {
+         *this = uuid_incremental_parser{};
+      }
+
+   private:
+      std::array<uint8_t, 16> m_data{ { 0 } };
+      size_t m_digits = 0;
+      size_t m_consumed = 0;
+      bool m_braced = false;
+      status m_status = status::incomplete;
+   };
+
+   // --------------------------------------------------------------------------------------------------------------------------
+   // compact text encodings
+   // --------------------------------------------------------------------------------------------------------------------------
+
+   namespace detail
+   {
+      inline constexpr char base64url_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+      inline constexpr char base32_alphabet[] = "0123456789ABCDEFGHJKMNPQRSTVWXYZ";
+      inline constexpr char base58_alphabet[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+      template <size_t Size>
+      [[nodiscard]] constexpr std::array<unsigned char, 256> make_digit_table(char const (&alphabet)[Size]) noexcept
+      {
+         std::array<unsigned char, 256> table{};
+         for (size_t i = 0; i < table.size(); ++i)
+            table[i] = 0xFF;
+         for (size_t i = 0; i + 1 < Size; ++i)
+            table[static_cast<unsigned char>(alphabet[i])] = static_cast<unsigned char>(i);
+         return table;
+      }
+
+      // Crockford's base32 is case insensitive and reads I and L as 1, and O as 0
+      [[nodiscard]] constexpr std::array<unsigned char, 256> make_base32_table() noexcept
+      {
+         auto table = make_digit_table(base32_alphabet);
+         for (size_t i = 0; i < 256; ++i)
+            if (i >= 'a' && i <= 'z')
+               table[i] = table[i - 'a' + 'A'];
+         table['I'] = table['i'] = table['L'] = table['l'] = 1;
+         table['O'] = table['o'] = 0;
+         return table;
+      }
+
+      inline constexpr std::array<unsigned char, 256> base64url_table = make_digit_table(base64url_alphabet);
+      inline constexpr std::array<unsigned char, 256> base32_table = make_base32_table();
+      inline constexpr std::array<unsigned char, 256> base58_table = make_digit_table(base58_alphabet);
+
+      // returns the value of a digit from a table, or 0xFF if the character is not a digit
+      template <typename TChar>
+      [[nodiscard]] constexpr unsigned char digit_value(std::array<unsigned char, 256> const & table, TChar const ch) noexcept
+      {
+         auto const code = static_cast<std::make_unsigned_t<TChar>>(ch);
+         if constexpr (sizeof(TChar) == 1)
+            return table[code];
+         else
+            return code < 256 ? table[code] : 0xFF;
+      }
+
+      // Encodes the 128 bits of data, most significant first, in digits of Bits bits each. The value is preceded by
+      // Lead zero bits, and the last digit is padded with zero bits on the right.
+      template <size_t Bits, size_t Lead, typename CharT, size_t N>
+      constexpr void encode_bits(uuid_string<CharT, N> & str, std::array<uint8_t, 16> const & data, char const * alphabet) noexcept
+      {
+         uint32_t buffer = 0;
+         size_t bits = Lead;
+         size_t index = 0;
+         for (uint8_t const byte : data)
+         {
+            buffer = (buffer << 8) | byte;
+            bits += 8;
+            while (bits >= Bits)
+            {
+               bits -= Bits;
+               str[index++] = static_cast<CharT>(alphabet[(buffer >> bits) & ((1u << Bits) - 1)]);
+            }
+            buffer &= (1u << bits) - 1;
+         }
+         if (bits > 0)
+            str[index] = static_cast<CharT>(alphabet[(buffer << (Bits - bits)) & ((1u << Bits) - 1)]);
+      }
+
+      // The inverse of encode_bits. Fails if a character is not a digit, or if any of the padding bits is set.
+      template <size_t Bits, size_t Lead, size_t N, typename TChar>
+      [[nodiscard]] constexpr bool decode_bits(std::basic_string_view<TChar> str, std::array<uint8_t, 16> & data,
+                                               std::array<unsigned char, 256> const & table) noexcept
+      {
+         if (str.size() != N)
+            return false;
+
+         uint32_t buffer = 0;
+         size_t bits = 0;
+         size_t index = 0;
+         for (size_t i = 0; i < N; ++i)
+         {
+            unsigned char const value = digit_value(table, str[i]);
+            if (value >= (1u << Bits) || (i == 0 && (value >> (Bits - Lead)) != 0))
+               return false;
+
+            buffer = (buffer << Bits) | value;
+            bits += i == 0 ? Bits - Lead : Bits;
+            if (bits >= 8)
+            {
+               bits -= 8;
+               data[index++] = static_cast<uint8_t>(buffer >> bits);
+               buffer &= (1u << bits) - 1;
+            }
+         }
+         return index == 16 && buffer == 0;
+      }
+   }
+
+   // Encodes a uuid as 22 characters of URL-safe base64 (RFC 4648 section 5), without padding.
+   template <typename CharT = char>
+   [[nodiscard]] constexpr uuid_string<CharT, 22> to_base64url(uuid const & id) noexcept
+   {
+      uuid_string<CharT, 22> str;
+      detail::encode_bits<6, 0>(str, detail::uuid_bytes(id), detail::base64url_alphabet);
+      return str;
+   }
+
+   // Decodes a uuid from exactly 22 characters of unpadded URL-safe base64.
+   template <typename StringType>
+   [[nodiscard]] constexpr std::optional<uuid> from_base64url(StringType const & in_str) noexcept
+   {
+      std::array<uint8_t, 16> data{ { 0 } };
+      if (!detail::decode_bits<6, 0, 22>(detail::to_string_view(in_str), data, detail::base64url_table))
+         return {};
+      return uuid{ data };
+   }
+
+   // Encodes a uuid as 26 characters of Crockford's base32, in upper case. The 128 bits are preceded by two zero
+   // bits, so the first character is always between 0 and 7, and the encoding sorts in the same order as the uuids.
+   template <typename CharT = char>
+   [[nodiscard]] constexpr uuid_string<CharT, 26> to_base32(uuid const & id) noexcept
+   {
+      uuid_string<CharT, 26> str;
+      detail::encode_bits<5, 2>(str, detail::uuid_bytes(id), detail::base32_alphabet);
+      return str;
+   }
+
+   // Decodes a uuid from exactly 26 characters of Crockford's base32, in either case.
+   template <typename StringType>
+   [[nodiscard]] constexpr std::optional<uuid> from_base32(StringType const & in_str) noexcept
+   {
+      std::array<uint8_t, 16> data{ { 0 } };
+      if (!detail::decode_bits<5, 2, 26>(detail::to_string_view(in_str), data, detail::base32_table))
+         return {};
+      return uuid{ data };
+   }
+
+   // Encodes a uuid as 22 characters of base58, with the Bitcoin alphabet, padded on the left with '1' (the zero
+   // digit) to a fixed width, so the encoding sorts in the same order as the uuids.
+   template <typename CharT = char>
+   [[nodiscard]] constexpr uuid_string<CharT, 22> to_base58(uuid const & id) noexcept
+   {
+      auto const & data = detail::uuid_bytes(id);
+      uint32_t limbs[4]{};
+      for (size_t i = 0; i < 16; ++i)
+         limbs[i / 4] = (limbs[i / 4] << 8) | data[i];
+
+      uuid_string<CharT, 22> str;
+      for (size_t i = 22; i-- > 0;)
+      {
+         uint64_t remainder = 0;
+         for (auto & limb : limbs)
+         {
+            uint64_t const value = (remainder << 32) | limb;
+            limb = static_cast<uint32_t>(value / 58);
+            remainder = value % 58;
+         }
+         str[i] = static_cast<CharT>(detail::base58_alphabet[remainder]);
+      }
+      return str;
+   }
+
+   // Decodes a uuid from exactly 22 characters of base58. Fails if the value does not fit in 128 bits.
+   template <typename StringType>
+   [[nodiscard]] constexpr std::optional<uuid> from_base58(StringType const & in_str) noexcept
+   {
+      auto const str = detail::to_string_view(in_str);
+      if (str.size() != 22)
+         return {};
+
+      uint32_t limbs[4]{};
+      for (size_t i = 0; i < 22; ++i)
+      {
+         uint64_t carry = detail::digit_value(detail::base58_table, str[i]);
+         if (carry >= 58)
+            return {};
+
+         for (size_t j = 4; j-- > 0;)
+         {
+            uint64_t const value = uint64_t{ limbs[j] } * 58 + carry;
+            limbs[j] = static_cast<uint32_t>(value);
+            carry = value >> 32;
+         }
+         if (carry != 0)
+            return {};
+      }
+
+      std::array<uint8_t, 16> data{ { 0 } };
+      for (size_t i = 0; i < 16; ++i)
+         data[i] = static_cast<uint8_t>(limbs[i / 4] >> (24 - 8 * (i % 4)));
+      return uuid{ data };
+   }
+
+   // --------------------------------------------------------------------------------------------------------------------------
+   // bulk operations
+   // --------------------------------------------------------------------------------------------------------------------------
+
+   namespace detail
+   {
+      // parses the strings in [first, last), which must all belong to the same 64 element block of the validity mask
+      template <typename StringType>
+      [[nodiscard]] uint64_t parse_block(StringType const * strs, uuid * ids, size_t const first, size_t const last) noexcept
+      {
+         uint64_t mask = 0;
+         for (size_t i = first; i < last; ++i)
+         {
+            std::array<uint8_t, 16> data{ { 0 } };
+            bool const valid = parse_uuid(to_string_view(strs[i]), data);
+            ids[i] = valid ? uuid{ data } : uuid{};
+            mask |= static_cast<uint64_t>(valid) << (i % 64);
+         }
+         return mask;
+      }
+
+      [[nodiscard]] constexpr size_t popcount(uint64_t value) noexcept
+      {
+         size_t count = 0;
+         for (; value != 0; value &= value - 1) ++count;
+         return count;
+      }
+
+      template <typename StringType>
+      [[nodiscard]] size_t parse_many_size(span<StringType const, dynamic_extent> strs, span<uuid, dynamic_extent> ids, span<uint64_t, dynamic_extent> valid) noexcept
+      {
+         return std::min({
+            static_cast<size_t>(strs.size()),
+            static_cast<size_t>(ids.size()),
+            static_cast<size_t>(valid.size()) * 64 });
+      }
+   }
+
+   // Parses strs[i] into ids[i] for every string and sets bit (i % 64) of valid[i / 64] if the string
+   // is a valid uuid. Invalid strings produce a nil uuid. Strings that do not have a corresponding element
+   // in ids or bit in valid are not parsed. Returns the number of valid uuids.
+   template <typename StringType>
+   size_t parse_many(span<StringType const, dynamic_extent> strs, span<uuid, dynamic_extent> ids, span<uint64_t, dynamic_extent> valid) noexcept
+   {
+      size_t const size = detail::parse_many_size(strs, ids, valid);
+      size_t count = 0;
+      for (size_t first = 0; first < size; first += 64)
+      {
+         uint64_t const mask = detail::parse_block(strs.data(), ids.data(), first, std::min(first + 64, size));
+         valid[first / 64] = mask;
+         count += detail::popcount(mask);
+      }
+      return count;
+   }
+
+#ifdef UUID_PARALLEL_ALGORITHMS
+   // Same as above, but the work is split in blocks of 64 strings processed according to the execution policy.
+   template <typename ExecutionPolicy, typename StringType,
+             typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+   size_t parse_many(ExecutionPolicy&& policy, span<StringType const, dynamic_extent> strs, span<uuid, dynamic_extent> ids, span<uint64_t, dynamic_extent> valid)
+   {
+      size_t const size = detail::parse_many_size(strs, ids, valid);
+      auto const first = valid.begin();
+      auto const last = first + static_cast<std::ptrdiff_t>((size + 63) / 64);
+
+      std::for_each(policy, first, last, [&](uint64_t & mask) {
+         size_t const block = static_cast<size_t>(&mask - valid.data()) * 64;
+         mask = detail::parse_block(strs.data(), ids.data(), block, std::min(block + 64, size));
+      });
+
+      return std::accumulate(first, last, size_t{ 0 }, [](size_t const count, uint64_t const mask) {
+         return count + detail::popcount(mask);
+      });
+   }
+#endif
+
+   namespace detail
+   {
+      template <typename CharT>
+      [[nodiscard]] size_t format_many_size(size_t const count, CharT const * separator) noexcept
+      {
+         if (count == 0) return 0;
+         return count * 36 + (separator ? count - 1 : 0);
+      }
+
+      template <typename CharT>
+      void format_one(uuid const * ids, size_t const index, CharT * first, CharT const * separator) noexcept
+      {
+         size_t const stride = separator ? 37 : 36;
+         CharT * out = first + index * stride;
+         if (separator && index > 0)
+            out[-1] = *separator;
+         to_chars(out, out + 36, ids[index]);
+      }
+
+      template <typename CharT>
+      to_chars_result<CharT> format_many(span<uuid const, dynamic_extent> ids, CharT * first, CharT * last, CharT const * separator) noexcept
+      {
+         size_t const size = format_many_size(static_cast<size_t>(ids.size()), separator);
+         if (static_cast<size_t>(last - first) < size)
+            return { last, std::errc::value_too_large };
+
+         for (size_t i = 0; i < static_cast<size_t>(ids.size()); ++i)
+            format_one(ids.data(), i, first, separator);
+         return { first + size, std::errc{} };
+      }
+
+#ifdef UUID_PARALLEL_ALGORITHMS
+      template <typename ExecutionPolicy, typename CharT>
+      to_chars_result<CharT> format_many(ExecutionPolicy && policy, span<uuid const, dynamic_extent> ids, CharT * first, CharT * last, CharT const * separator)
+      {
+         size_t const size = format_many_size(static_cast<size_t>(ids.size()), separator);
+         if (static_cast<size_t>(last - first) < size)
+            return { last, std::errc::value_too_large };
+
+         std::for_each(policy, ids.begin(), ids.end(), [&](uuid const & id) {
+            format_one(ids.data(), static_cast<size_t>(&id - ids.data()), first, separator);
+         });
+         return { first + size, std::errc{} };
+      }
+#endif
+   }
+
+   // Writes the canonical textual representation of every uuid in ids to [first, last), one after the other, each
+   // taking exactly 36 characters, optionally separated by a separator character. On success, ptr points past the
+   // last character written. If the range is too small, ptr is last, ec is std::errc::value_too_large and nothing
+   // is written.
+   template <typename CharT>
+   to_chars_result<CharT> format_many(span<uuid const, dynamic_extent> ids, CharT * first, CharT * last) noexcept
+   {
+      return detail::format_many(ids, first, last, static_cast<CharT const *>(nullptr));
+   }
+
+   template <typename CharT>
+   to_chars_result<CharT> format_many(span<uuid const, dynamic_extent> ids, CharT * first, CharT * last, CharT const separator) noexcept
+   {
+      return detail::format_many(ids, first, last, &separator);
+   }
+
+#ifdef UUID_PARALLEL_ALGORITHMS
+   // Same as above, but the uuids are formatted according to the execution policy.
+   template <typename ExecutionPolicy, typename CharT,
+             typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+   to_chars_result<CharT> format_many(ExecutionPolicy && policy, span<uuid const, dynamic_extent> ids, CharT * first, CharT * last)
+   {
+      return detail::format_many(std::forward<ExecutionPolicy>(policy), ids, first, last, static_cast<CharT const *>(nullptr));
+   }
+
+   template <typename ExecutionPolicy, typename CharT,
+             typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+   to_chars_result<CharT> format_many(ExecutionPolicy && policy, span<uuid const, dynamic_extent> ids, CharT * first, CharT * last, CharT const separator)
+   {
+      return detail::format_many(std::forward<ExecutionPolicy>(policy), ids, first, last, &separator);
+   }
+#endif
+
+   namespace detail
+   {
+      template <typename TChar>
+      [[nodiscard]] constexpr bool is_record_delimiter(TChar const ch) noexcept
+      {
+         return ch == '\n' || ch == '\r' || ch == ',';
+      }
+   }
+
+   // Scans a buffer of uuids separated by new lines (\n or \r\n) or commas, without copying it. Calls
+   // on_uuid(uuid const &) for every valid uuid and on_error(size_t offset, basic_string_view field) for
+   // every field that is not a valid uuid, where offset is the position of the field in the buffer.
+   // Empty fields are skipped. Returns the number of valid uuids.
+   template <typename StringType, typename UuidHandler, typename ErrorHandler>
+   size_t scan_uuids(StringType const & in_buffer, UuidHandler && on_uuid, ErrorHandler && on_error)
+   {
+      auto const buffer = detail::to_string_view(in_buffer);
+      size_t const size = buffer.size();
+      size_t count = 0;
+
+      for (size_t pos = 0; pos < size; )
+      {
+         std::array<uint8_t, 16> data{ { 0 } };
+         bool valid = false;
+
+         // records are usually canonical uuids, in which case the delimiter is at a known position
+         size_t end = pos + 36;
+         if (end <= size && (end == size || detail::is_record_delimiter(buffer[end])))
+            valid = detail::parse_uuid(buffer.substr(pos, 36), data);
+
+         if (!valid)
+         {
+            end = pos;
+            while (end < size && !detail::is_record_delimiter(buffer[end])) ++end;
+
+            if (end > pos)
+            {
+               auto const field = buffer.substr(pos, end - pos);
+               valid = detail::parse_uuid(field, data);
+               if (!valid)
+                  on_error(pos, field);
+            }
+         }
+
+         if (valid)
+         {
+            on_uuid(uuid{ data });
+            ++count;
+         }
+
+         pos = end + 1;
+      }
+
+      return count;
+   }
+
+   // --------------------------------------------------------------------------------------------------------------------------
+   // hash functions
+   // --------------------------------------------------------------------------------------------------------------------------
+
+   namespace detail
+   {
+      [[nodiscard]] constexpr uint64_t bswap64(uint64_t const value) noexcept
+      {
+         return
+            (value & 0x00000000000000FFull) << 56 | (value & 0x000000000000FF00ull) << 40 |
+            (value & 0x0000000000FF0000ull) << 24 | (value & 0x00000000FF000000ull) <<  8 |
+            (value & 0x000000FF00000000ull) >>  8 | (value & 0x0000FF0000000000ull) >> 24 |
+            (value & 0x00FF000000000000ull) >> 40 | (value & 0xFF00000000000000ull) >> 56;
+      }
+
+      // the full 128-bit product of two 64-bit numbers, folded to 64 bits by xor-ing its halves
+      [[nodiscard]] constexpr uint64_t mul128_fold64(uint64_t const lhs, uint64_t const rhs) noexcept
+      {
+#ifdef __SIZEOF_INT128__
+         __extension__ typedef unsigned __int128 uint128_t;
+         uint128_t const product = static_cast<uint128_t>(lhs) * rhs;
+         return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+         uint64_t const lo_lo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+         uint64_t const hi_lo = (lhs >> 32) * (rhs & 0xFFFFFFFF);
+         uint64_t const lo_hi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+         uint64_t const hi_hi = (lhs >> 32) * (rhs >> 32);
+         uint64_t const cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+         uint64_t const upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+         uint64_t const lower = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+         return lower ^ upper;
+#endif
+      }
+   }
+
+   namespace detail
+   {
+      // the hash of std::hash<uuid>: the two halves of the uuid, read as big-endian numbers, xor-ed together
+      [[nodiscard]] constexpr size_t fold_hash(std::array<uint8_t, 16> const & data) noexcept
+      {
+         uint64_t const hash64 = load64_be(data.data()) ^ load64_be(data.data() + 8);
+         if constexpr (sizeof(size_t) > 4)
+            return static_cast<size_t>(hash64);
+         else
+            return static_cast<size_t>(uint32_t(hash64 >> 32) ^ uint32_t(hash64));
+      }
+   }
+
+   // A fast hash that mixes all 128 bits of a uuid into the result with two multiplications, so that uuids differing
+   // only in a few bits, such as time-based or sequential ones, are spread evenly over the buckets of a hash table.
+   struct fast_uuid_hash
+   {
+      [[nodiscard]] size_t operator()(uuid const & id) const noexcept
+      {
+         auto const & data = detail::uuid_bytes(id);
+         uint64_t h = detail::load64(data.data()) ^ (detail::load64(data.data() + 8) * 0x9E3779B97F4A7C15ull);
+         h ^= h >> 32;
+         h *= 0xD6E8FEB86659FD93ull;
+         h ^= h >> 32;
+         h *= 0xD6E8FEB86659FD93ull;
+         h ^= h >> 32;
+         return static_cast<size_t>(h);
+      }
+   };
+
+   // The XXH3 64-bit hash, with the default secret and seed, of the 16 octets of a uuid; the same value as
+   // XXH3_64bits(data, 16) on any platform.
+   struct xxh3_uuid_hash
+   {
+      [[nodiscard]] constexpr size_t operator()(uuid const & id) const noexcept
+      {
+         // the default XXH3 secret, read as little-endian numbers at offsets 24, 32, 40 and 48
+         constexpr uint64_t bitflip1 = 0x1F67B3B7A4A44072ull ^ 0x78E5C0CC4EE679CBull;
+         constexpr uint64_t bitflip2 = 0x2172FFCC7DD05A82ull ^ 0x8E2443F7744608B8ull;
+
+         auto const & data = detail::uuid_bytes(id);
+         uint64_t const lo = detail::load64_le(data.data()) ^ bitflip1;
+         uint64_t const hi = detail::load64_le(data.data() + 8) ^ bitflip2;
+         uint64_t h = 16 + detail::bswap64(lo) + hi + detail::mul128_fold64(lo, hi);
+         h ^= h >> 37;
+         h *= 0x165667919E3779F9ull;
+         h ^= h >> 32;
+         return static_cast<size_t>(h);
+      }
+   };
+
+   // Hashes the canonical textual representation of a uuid with std::hash<std::string_view>, from a buffer on the
+   // stack, so that the result is the same as hashing the string returned by to_string, without allocating it.
+   struct string_uuid_hash
+   {
+      [[nodiscard]] size_t operator()(uuid const & id) const noexcept
+      {
+         char chars[36];
+         detail::encode_as<uuid_format::canonical, uuid_case::lower>(chars, detail::uuid_bytes(id));
+         return std::hash<std::string_view>{}(std::string_view(chars, 36));
+      }
+   };
+
+   namespace detail
+   {
+      [[nodiscard]] constexpr uint64_t rotl64(uint64_t const value, int const shift) noexcept
+      {
+         return (value << shift) | (value >> (64 - shift));
+      }
+
+      // SipHash-1-3 of exactly 16 octets, under a 128-bit key
+      [[nodiscard]] constexpr uint64_t siphash13(std::array<uint64_t, 2> const & key, std::array<uint8_t, 16> const & data) noexcept
+      {
+         uint64_t v0 = key[0] ^ 0x736F6D6570736575ull;
+         uint64_t v1 = key[1] ^ 0x646F72616E646F6Dull;
+         uint64_t v2 = key[0] ^ 0x6C7967656E657261ull;
+         uint64_t v3 = key[1] ^ 0x7465646279746573ull;
+
+         auto const round = [&]() {
+            v0 += v1; v1 = rotl64(v1, 13); v1 ^= v0; v0 = rotl64(v0, 32);
+            v2 += v3; v3 = rotl64(v3, 16); v3 ^= v2;
+            v0 += v3; v3 = rotl64(v3, 21); v3 ^= v0;
+            v2 += v1; v1 = rotl64(v1, 17); v1 ^= v2; v2 = rotl64(v2, 32);
+         };
+
+         // the two message words, followed by the final block holding only the length
+         uint64_t const words[3] = { load64_le(data.data()), load64_le(data.data() + 8), uint64_t{ 16 } << 56 };
+         for (uint64_t const m : words)
+         {
+            v3 ^= m;
+            round();
+            v0 ^= m;
+         }
+
+         v2 ^= 0xFF;
+         round();
+         round();
+         round();
+         return v0 ^ v1 ^ v2 ^ v3;
+      }
+
+      // a random key, drawn once per process
+      inline std::array<uint64_t, 2> const & process_hash_key()
+      {
+         static std::array<uint64_t, 2> const key = []() {
+            std::random_device rd;
+            std::array<uint64_t, 2> k{};
+            for (auto & word : k)
+               word = static_cast<uint64_t>(rd()) << 32 | static_cast<uint32_t>(rd());
+            return k;
+         }();
+         return key;
+      }
+   }
+
+   // A hash keyed with a secret 128-bit key, for tables holding uuids chosen by untrusted parties: without the key,
+   // uuids that collide cannot be predicted. Default-constructed instances share a random key drawn once per process.
+   // The hash is SipHash-1-3 of the 16 octets.
+   class keyed_uuid_hash
+   {
+   public:
+      using key_type = std::array<uint64_t, 2>;
+
+      keyed_uuid_hash() : m_key(detail::process_hash_key()) {}
+
+      constexpr explicit keyed_uuid_hash(key_type const & key) noexcept : m_key(key) {}
+
+      [[nodiscard]] constexpr key_type const & key() const noexcept { return m_key; }
+
+      [[nodiscard]] constexpr size_t operator()(uuid const & id) const noexcept
+      {
+         return static_cast<size_t>(detail::siphash13(m_key, detail::uuid_bytes(id)));
+      }
+
+   private:
+      key_type m_key;
+   };
+
+   // The cheapest hash, for tables holding only random (version 4) uuids, whose bits are already uniformly distributed:
+   // the first 8 octets, read as a little-endian number. Every run of 8 octets contains the version (octet 6) or the
+   // variant (octet 8); with this one the 4 fixed version bits end up in bits 52 to 55 of the hash, which are not used
+   // to pick a bucket, while the variant octet would put its 2 fixed bits in bits 6 and 7.
+   struct random_uuid_hash
+   {
+      [[nodiscard]] constexpr size_t operator()(uuid const & id) const noexcept
+      {
+         assert(id.version() == uuid_version::random_number_based);
+         return static_cast<size_t>(detail::load64_le(detail::uuid_bytes(id).data()));
+      }
+   };
+
+   // Writes hasher(ids[i]) to out[i] for every uuid that has a corresponding element in out, and returns the number of
+   // hashes written. The values are the same as those of the hasher called on each uuid.
+   template <typename Hasher = std::hash<uuid>>
+   size_t hash_many(span<uuid const, dynamic_extent> ids, span<uint64_t, dynamic_extent> out, Hasher const & hasher = Hasher{})
+   {
+      size_t const size = std::min(static_cast<size_t>(ids.size()), static_cast<size_t>(out.size()));
+      uuid const * const first = ids.data();
+      uint64_t * const result = out.data();
+      for (size_t i = 0; i < size; ++i)
+         result[i] = static_cast<uint64_t>(hasher(first[i]));
+      return size;
+   }
+
+#ifdef UUID_PARALLEL_ALGORITHMS
+   // Same as above, but the uuids are hashed according to the execution policy.
+   template <typename ExecutionPolicy, typename Hasher = std::hash<uuid>,
+             typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+   size_t hash_many(ExecutionPolicy&& policy, span<uuid const, dynamic_extent> ids, span<uint64_t, dynamic_extent> out, Hasher const & hasher = Hasher{})
+   {
+      size_t const size = std::min(static_cast<size_t>(ids.size()), static_cast<size_t>(out.size()));
+      std::transform(policy, ids.data(), ids.data() + size, out.data(), [&hasher](uuid const & id) {
+         return static_cast<uint64_t>(hasher(id));
+      });
+      return size;
+   }
+#endif
+
    // --------------------------------------------------------------------------------------------------------------------------
    // namespace IDs that could be used for generating name-based uuids
    // --------------------------------------------------------------------------------------------------------------------------
@@ -928,40 +2362,42 @@ namespace std
       [[nodiscard]] result_type operator()(argument_type const &uuid) const
       {
 #ifdef UUID_HASH_STRING_BASED
-         std::hash<std::string> hasher;
-         return static_cast<result_type>(hasher(uuids::to_string(uuid)));
+         return static_cast<result_type>(uuids::string_uuid_hash{}(uuid));
 #else
-         uint64_t l =
-            static_cast<uint64_t>(uuid.data[0]) << 56 |
-            static_cast<uint64_t>(uuid.data[1]) << 48 |
-            static_cast<uint64_t>(uuid.data[2]) << 40 |
-            static_cast<uint64_t>(uuid.data[3]) << 32 |
-            static_cast<uint64_t>(uuid.data[4]) << 24 |
-            static_cast<uint64_t>(uuid.data[5]) << 16 |
-            static_cast<uint64_t>(uuid.data[6]) <<  8 |
-            static_cast<uint64_t>(uuid.data[7]);
-         uint64_t h =
-            static_cast<uint64_t>(uuid.data[8])  << 56 |
-            static_cast<uint64_t>(uuid.data[9])  << 48 |
-            static_cast<uint64_t>(uuid.data[10]) << 40 |
-            static_cast<uint64_t>(uuid.data[11]) << 32 |
-            static_cast<uint64_t>(uuid.data[12]) << 24 |
-            static_cast<uint64_t>(uuid.data[13]) << 16 |
-            static_cast<uint64_t>(uuid.data[14]) <<  8 |
-            static_cast<uint64_t>(uuid.data[15]);
-
-         if constexpr (sizeof(result_type) > 4)
-         {
-            return result_type(l ^ h);
-         }
-         else
-         {
-            uint64_t hash64 = l ^ h;
-            return result_type(uint32_t(hash64 >> 32) ^ uint32_t(hash64));
-         }
+         return static_cast<result_type>(uuids::detail::fold_hash(uuid.data));
 #endif
       }
    };
+
+#ifdef __cpp_lib_format
+   // Formats a uuid with std::format. The format specification accepts 'U' for upper case and one of 'c' (compact),
+   // 'b' (braced) or 'r' (urn), e.g. "{:Ub}".
+   template <typename CharT>
+   struct formatter<uuids::uuid, CharT> : uuids::detail::basic_uuid_formatter<CharT, std::format_error>
+   {
+   };
+
+   template <typename Policy, typename CharT>
+   struct formatter<uuids::deferred_uuid<Policy>, CharT> : uuids::detail::deferred_uuid_formatter<CharT, Policy, std::format_error>
+   {
+   };
+#endif
+}
+
+#ifdef FMT_VERSION
+namespace fmt
+{
+   // Formats a uuid with fmt, accepting the same format specification as the std::formatter specialization.
+   template <typename CharT>
+   struct formatter<uuids::uuid, CharT> : uuids::detail::basic_uuid_formatter<CharT, fmt::format_error>
+   {
+   };
+
+   template <typename Policy, typename CharT>
+   struct formatter<uuids::deferred_uuid<Policy>, CharT> : uuids::detail::deferred_uuid_formatter<CharT, Policy, fmt::format_error>
+   {
+   };
 }
+#endif
 
 #endif /* STDUUID_H */
@@ -0,0 +1,243 @@
+// Micro-benchmarks comparing the operations of uuid with the straightforward implementations they replaced.
+// Build with -DUUID_BUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release and run bench_stduuid.
+
+#include "uuid.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace uuids;
+
+namespace
+{
+   // the number of elements every benchmark works on
+   constexpr size_t count = 1'000'000;
+
+   // results are accumulated here so that the compiler cannot drop the work being measured
+   volatile uint64_t sink = 0;
+
+   // returns the shortest of several runs of work, in milliseconds
+   template <typename Work>
+   double measure(Work && work, int const runs = 5)
+   {
+      double best = 0;
+      for (int i = 0; i < runs; ++i)
+      {
+         auto const start = std::chrono::steady_clock::now();
+         work();
+         std::chrono::duration<double, std::milli> const elapsed = std::chrono::steady_clock::now() - start;
+         if (i == 0 || elapsed.count() < best)
+            best = elapsed.count();
+      }
+      return best;
+   }
+
+   void report(char const * name, double const baseline, double const current)
+   {
+      std::printf("%-36s %12.1f %12.1f %9.2fx\n", name, baseline, current, baseline / current);
+   }
+
+   std::vector<uuid> make_ids()
+   {
+      std::mt19937 engine{ 42 };
+      uuid_random_generator gen{ engine };
+      std::vector<uuid> ids(count);
+      std::generate(ids.begin(), ids.end(), gen);
+      return ids;
+   }
+
+   using octets = std::array<uint8_t, 16>;
+
+   std::vector<octets> to_octets(std::vector<uuid> const & ids)
+   {
+      std::vector<octets> result(ids.size());
+      for (size_t i = 0; i < ids.size(); ++i)
+      {
+         auto const bytes = ids[i].as_bytes();
+         std::memcpy(result[i].data(), bytes.data(), 16);
+      }
+      return result;
+   }
+
+   // sorts a copy of values; the copy is made before the clock starts
+   template <typename T>
+   double measure_sort(std::vector<T> const & values)
+   {
+      std::vector<T> copy;
+      return measure([&]() {
+         copy = values;
+         std::sort(copy.begin(), copy.end());
+         sink = sink + (copy.front() < copy.back());
+      });
+   }
+
+   // fills a set with values, then looks every value up
+   template <typename T>
+   double measure_set(std::vector<T> const & values)
+   {
+      return measure([&]() {
+         std::set<T> set(values.begin(), values.end());
+         size_t found = 0;
+         for (auto const & value : values)
+            found += set.count(value);
+         sink = sink + found;
+      }, 1);
+   }
+
+   // the character-by-character parser that uuid::from_string and uuid::is_valid_uuid used before
+   namespace scalar
+   {
+      unsigned char hex2char(char const ch)
+      {
+         if (ch >= '0' && ch <= '9')
+            return static_cast<unsigned char>(ch - '0');
+         if (ch >= 'a' && ch <= 'f')
+            return static_cast<unsigned char>(10 + ch - 'a');
+         if (ch >= 'A' && ch <= 'F')
+            return static_cast<unsigned char>(10 + ch - 'A');
+         return 0;
+      }
+
+      bool is_hex(char const ch)
+      {
+         return
+            (ch >= '0' && ch <= '9') ||
+            (ch >= 'a' && ch <= 'f') ||
+            (ch >= 'A' && ch <= 'F');
+      }
+
+      // parses str into data, if data is not null
+      bool parse(std::string_view const str, octets* const data)
+      {
+         bool firstDigit = true;
+         size_t hasBraces = 0;
+         size_t index = 0;
+
+         if (str.empty())
+            return false;
+
+         if (str.front() == '{')
+            hasBraces = 1;
+         if (hasBraces && str.back() != '}')
+            return false;
+
+         for (size_t i = hasBraces; i < str.size() - hasBraces; ++i)
+         {
+            if (str[i] == '-') continue;
+
+            if (index >= 16 || !is_hex(str[i]))
+               return false;
+
+            if (firstDigit)
+            {
+               if (data) (*data)[index] = static_cast<uint8_t>(hex2char(str[i]) << 4);
+               firstDigit = false;
+            }
+            else
+            {
+               if (data) (*data)[index] = static_cast<uint8_t>((*data)[index] | hex2char(str[i]));
+               index++;
+               firstDigit = true;
+            }
+         }
+
+         return index == 16;
+      }
+   }
+
+   void compare_parsing(std::vector<uuid> const & ids)
+   {
+      std::vector<std::string> strings;
+      strings.reserve(ids.size());
+      for (auto const & id : ids)
+         strings.push_back(to_string(id));
+
+      report("from_string", measure([&]() {
+         uint64_t total = 0;
+         octets data{};
+         for (auto const & str : strings)
+            if (scalar::parse(str, &data))
+               total += data[0];
+         sink = sink + total;
+      }), measure([&]() {
+         uint64_t total = 0;
+         for (auto const & str : strings)
+            if (auto const id = uuid::from_string(str))
+               total += static_cast<uint8_t>(id->as_bytes()[0]);
+         sink = sink + total;
+      }));
+      report("is_valid_uuid", measure([&]() {
+         size_t valid = 0;
+         for (auto const & str : strings)
+            valid += scalar::parse(str, nullptr);
+         sink = sink + valid;
+      }), measure([&]() {
+         size_t valid = 0;
+         for (auto const & str : strings)
+            valid += uuid::is_valid_uuid(str);
+         sink = sink + valid;
+      }));
+   }
+
+   template <typename Hash>
+   void report_hash(char const * name, std::vector<uuid> const & ids, Hash const & hash = Hash{})
+   {
+      auto const elapsed = measure([&]() {
+         size_t total = 0;
+         for (auto const & id : ids)
+            total ^= hash(id);
+         sink = sink + total;
+      });
+      std::printf("%-36s %12.1f %12.2f\n", name, elapsed, elapsed * 1'000'000 / static_cast<double>(ids.size()));
+   }
+
+   void compare_hashes(std::vector<uuid> const & ids)
+   {
+      std::printf("\n%-36s %12s %12s\n", "hash (1M elements)", "time (ms)", "ns/hash");
+      report_hash<std::hash<uuid>>("std::hash<uuid>", ids);
+      report_hash<fast_uuid_hash>("fast_uuid_hash", ids);
+      report_hash<xxh3_uuid_hash>("xxh3_uuid_hash", ids);
+      report_hash<random_uuid_hash>("random_uuid_hash", ids);
+      report_hash<keyed_uuid_hash>("keyed_uuid_hash", ids);
+   }
+
+   void compare_operators(std::vector<uuid> const & ids)
+   {
+      // std::array compares the octets lexicographically, as uuid did before comparing 64-bit words
+      auto const arrays = to_octets(ids);
+
+      report("std::sort", measure_sort(arrays), measure_sort(ids));
+      report("std::set insert and find", measure_set(arrays), measure_set(ids));
+      report("operator==", measure([&]() {
+         size_t equal = 0;
+         for (size_t i = 1; i < arrays.size(); ++i)
+            equal += arrays[i - 1] == arrays[i];
+         sink = sink + equal;
+      }), measure([&]() {
+         size_t equal = 0;
+         for (size_t i = 1; i < ids.size(); ++i)
+            equal += ids[i - 1] == ids[i];
+         sink = sink + equal;
+      }));
+   }
+}
+
+int main()
+{
+   auto const ids = make_ids();
+
+   std::printf("%-36s %12s %12s %10s\n", "benchmark (1M elements)", "before (ms)", "now (ms)", "speedup");
+   compare_operators(ids);
+   compare_parsing(ids);
+   compare_hashes(ids);
+
+   return 0;
+}
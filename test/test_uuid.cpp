@@ -1,3 +1,9 @@
+#ifdef UUID_TEST_WITH_FMT
+// fmt must be included before uuid.h for the fmt::formatter specializations to be defined
+#include <fmt/format.h>
+#include <fmt/xchar.h>
+#endif
+
 #include "uuid.h"
 #include "catch.hpp"
 
@@ -6,6 +12,11 @@
 #include <unordered_set>
 #include <vector>
 #include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cctype>
+#include <string_view>
 
 using namespace uuids;
 
@@ -43,6 +54,244 @@ TEST_CASE("Test string conversion", "[ops]")
    REQUIRE(uuids::to_string<wchar_t>(empty) == L"00000000-0000-0000-0000-000000000000");
 }
 
+TEST_CASE("Test string conversion to other character types", "[ops]")
+{
+   auto id = uuids::uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+   REQUIRE(uuids::to_string<char16_t>(id) == u"47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(uuids::to_string<char32_t>(id) == U"47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(uuids::uuid::from_string(uuids::to_string<char16_t>(id)) == id);
+   REQUIRE(uuids::uuid::from_string(uuids::to_string<char32_t>(id)) == id);
+#ifdef __cpp_char8_t
+   REQUIRE(uuids::to_string<char8_t>(id) == u8"47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(uuids::uuid::from_string(u8"47183823-2574-4bfd-b411-99ed177d3e43") == id);
+#endif
+}
+
+TEST_CASE("Test string conversion of all octet values", "[ops]")
+{
+   for (int first = 0; first < 256; first += 16)
+   {
+      std::array<uuids::uuid::value_type, 16> arr{};
+      std::ostringstream expected;
+      expected << std::hex << std::setfill('0');
+      for (int i = 0; i < 16; ++i)
+      {
+         arr[i] = static_cast<uuids::uuid::value_type>(first + i);
+         if (i == 4 || i == 6 || i == 8 || i == 10) expected << '-';
+         expected << std::setw(2) << first + i;
+      }
+
+      uuid const id{ arr };
+      std::string const expected_lower = expected.str();
+      REQUIRE(uuids::to_string(id) == expected_lower);
+      REQUIRE(uuids::to_string<wchar_t>(id) == std::wstring(expected_lower.begin(), expected_lower.end()));
+
+      char upper[36];
+      uuids::to_chars(std::begin(upper), std::end(upper), id, uuid_format::canonical, uuid_case::upper);
+      std::string expected_upper = expected_lower;
+      std::transform(expected_upper.begin(), expected_upper.end(), expected_upper.begin(), ::toupper);
+      REQUIRE(std::string(std::begin(upper), std::end(upper)) == expected_upper);
+   }
+}
+
+TEST_CASE("Test to_fixed_string", "[ops]")
+{
+   constexpr uuid id = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+   constexpr auto str = uuids::to_fixed_string(id);
+   static_assert(str.size() == 36);
+   static_assert(str.view() == "47183823-2574-4bfd-b411-99ed177d3e43");
+
+   REQUIRE(std::strlen(str.c_str()) == 36);
+   REQUIRE(std::string(str.begin(), str.end()) == uuids::to_string(id));
+   REQUIRE(str == uuids::to_fixed_string(id));
+   REQUIRE(str != uuids::to_fixed_string(uuid{}));
+
+   std::string_view view = str;
+   REQUIRE(view == "47183823-2574-4bfd-b411-99ed177d3e43");
+
+   auto wstr = uuids::to_fixed_string<wchar_t>(id);
+   REQUIRE(wstr.view() == L"47183823-2574-4bfd-b411-99ed177d3e43");
+
+   std::ostringstream os;
+   os << str;
+   REQUIRE(os.str() == "47183823-2574-4bfd-b411-99ed177d3e43");
+}
+
+TEST_CASE("Test format policies", "[ops]")
+{
+   constexpr uuid id = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   static_assert(uuids::rfc_format::size == 36);
+   static_assert(uuids::registry_format::size == 38);
+   static_assert(uuids::is_uuid_format_policy_v<uuids::registry_format>);
+   static_assert(!uuids::is_uuid_format_policy_v<char>);
+
+   static_assert(uuids::to_fixed_string<uuids::rfc_format>(id).view() == "47183823-2574-4bfd-b411-99ed177d3e43");
+   static_assert(uuids::to_fixed_string<uuids::registry_format>(id).view() == "{47183823-2574-4BFD-B411-99ED177D3E43}");
+
+   using compact_upper = uuids::uuid_format_policy<uuid_format::compact, uuid_case::upper>;
+   using urn_lower = uuids::uuid_format_policy<uuid_format::urn>;
+   REQUIRE(uuids::to_fixed_string<compact_upper>(id).view() == "4718382325744BFDB41199ED177D3E43");
+   REQUIRE(uuids::to_fixed_string<urn_lower, wchar_t>(id).view() == L"urn:uuid:47183823-2574-4bfd-b411-99ed177d3e43");
+
+   char buffer[45];
+   for (auto format : { uuid_format::canonical, uuid_format::braced, uuid_format::compact, uuid_format::urn })
+   {
+      for (auto letter_case : { uuid_case::lower, uuid_case::upper })
+      {
+         auto const expected = uuids::to_chars(buffer, buffer + 45, id, format, letter_case);
+         std::string const text(buffer, expected.ptr);
+
+         auto const policy = [&](auto p) {
+            using policy_type = decltype(p);
+            if (policy_type::format != format || policy_type::letter_case != letter_case) return;
+            auto [ptr, ec] = uuids::to_chars<policy_type>(buffer, buffer + 45, id);
+            REQUIRE(ec == std::errc{});
+            REQUIRE(std::string(buffer, ptr) == text);
+         };
+         policy(uuids::uuid_format_policy<uuid_format::canonical, uuid_case::lower>{});
+         policy(uuids::uuid_format_policy<uuid_format::canonical, uuid_case::upper>{});
+         policy(uuids::uuid_format_policy<uuid_format::braced, uuid_case::lower>{});
+         policy(uuids::uuid_format_policy<uuid_format::braced, uuid_case::upper>{});
+         policy(uuids::uuid_format_policy<uuid_format::compact, uuid_case::lower>{});
+         policy(uuids::uuid_format_policy<uuid_format::compact, uuid_case::upper>{});
+         policy(uuids::uuid_format_policy<uuid_format::urn, uuid_case::lower>{});
+         policy(uuids::uuid_format_policy<uuid_format::urn, uuid_case::upper>{});
+      }
+   }
+
+   auto [ptr, ec] = uuids::to_chars<uuids::registry_format>(buffer, buffer + 37, id);
+   REQUIRE(ec == std::errc::value_too_large);
+   REQUIRE(ptr == buffer + 37);
+}
+
+TEST_CASE("Test deferred_uuid", "[ops]")
+{
+   constexpr uuid id = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   static_assert(sizeof(uuids::deferred_uuid<>) == sizeof(uuid));
+   static_assert(std::is_trivially_copyable_v<uuids::deferred_uuid<uuids::registry_format>>);
+
+   constexpr uuids::deferred_uuid deferred{ id };
+   static_assert(std::is_same_v<decltype(deferred)::policy_type, uuids::rfc_format>);
+   static_assert(deferred.to_fixed_string().view() == "47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(deferred.id() == id);
+
+   {
+      std::ostringstream os;
+      os << deferred << '|' << uuids::deferred_uuid<uuids::registry_format>{ id };
+      REQUIRE(os.str() == "47183823-2574-4bfd-b411-99ed177d3e43|{47183823-2574-4BFD-B411-99ED177D3E43}");
+   }
+
+   {
+      std::wostringstream os;
+      os << std::setw(34) << std::setfill(L'*') << uuids::deferred_uuid<uuids::uuid_format_policy<uuid_format::compact>>{ id };
+      REQUIRE(os.str() == L"**4718382325744bfdb41199ed177d3e43");
+   }
+
+#ifdef __cpp_lib_format
+   REQUIRE(std::format("{}", deferred) == "47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(std::format("{}", uuids::deferred_uuid<uuids::registry_format>{ id }) == "{47183823-2574-4BFD-B411-99ED177D3E43}");
+   REQUIRE(std::format("{:c}", uuids::deferred_uuid<uuids::registry_format>{ id }) == "4718382325744BFDB41199ED177D3E43");
+#endif
+}
+
+#ifdef UUID_TEST_WITH_FMT
+TEST_CASE("Test fmt::format", "[ops]")
+{
+   auto id = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   REQUIRE(fmt::format("{}", id) == "47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(fmt::format("{:U}", id) == "47183823-2574-4BFD-B411-99ED177D3E43");
+   REQUIRE(fmt::format("{:c}", id) == "4718382325744bfdb41199ed177d3e43");
+   REQUIRE(fmt::format("{:Ub}", id) == "{47183823-2574-4BFD-B411-99ED177D3E43}");
+   REQUIRE(fmt::format("{:r}", id) == "urn:uuid:47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(fmt::format(L"{:c}", id) == L"4718382325744bfdb41199ed177d3e43");
+   REQUIRE(fmt::format(L"{:bU}", id) == L"{47183823-2574-4BFD-B411-99ED177D3E43}");
+
+   REQUIRE_THROWS_AS(fmt::format(fmt::runtime("{:x}"), id), fmt::format_error);
+   REQUIRE_THROWS_AS(fmt::format(fmt::runtime("{:cb}"), id), fmt::format_error);
+   REQUIRE_THROWS_AS(fmt::format(fmt::runtime("{:UU}"), id), fmt::format_error);
+
+   REQUIRE(fmt::format("{}", uuids::deferred_uuid{ id }) == "47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(fmt::format("{}", uuids::deferred_uuid<uuids::registry_format>{ id }) == "{47183823-2574-4BFD-B411-99ED177D3E43}");
+   REQUIRE(fmt::format("{:c}", uuids::deferred_uuid<uuids::registry_format>{ id }) == "4718382325744BFDB41199ED177D3E43");
+   REQUIRE(fmt::format(L"{:r}", uuids::deferred_uuid{ id }) == L"urn:uuid:47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE_THROWS_AS(fmt::format(fmt::runtime("{:x}"), uuids::deferred_uuid{ id }), fmt::format_error);
+}
+#endif
+
+#ifdef __cpp_lib_format
+TEST_CASE("Test std::format", "[ops]")
+{
+   auto id = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   REQUIRE(std::format("{}", id) == "47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(std::format("{:U}", id) == "47183823-2574-4BFD-B411-99ED177D3E43");
+   REQUIRE(std::format("{:c}", id) == "4718382325744bfdb41199ed177d3e43");
+   REQUIRE(std::format("{:bU}", id) == "{47183823-2574-4BFD-B411-99ED177D3E43}");
+   REQUIRE(std::format("{:r}", id) == "urn:uuid:47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(std::format(L"{:Ub}", id) == L"{47183823-2574-4BFD-B411-99ED177D3E43}");
+
+   REQUIRE_THROWS_AS(std::vformat("{:x}", std::make_format_args(id)), std::format_error);
+   REQUIRE_THROWS_AS(std::vformat("{:cb}", std::make_format_args(id)), std::format_error);
+}
+#endif
+
+TEST_CASE("Test to_chars", "[ops]")
+{
+   using namespace std::string_view_literals;
+
+   auto const id = uuids::uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   {
+      char buffer[40];
+      auto [ptr, ec] = uuids::to_chars(std::begin(buffer), std::end(buffer), id);
+      REQUIRE(ec == std::errc{});
+      REQUIRE(std::string_view(buffer, ptr - buffer) == "47183823-2574-4bfd-b411-99ed177d3e43");
+   }
+
+   {
+      char buffer[38];
+      auto [ptr, ec] = uuids::to_chars(std::begin(buffer), std::end(buffer), id, uuid_format::braced, uuid_case::upper);
+      REQUIRE(ec == std::errc{});
+      REQUIRE(ptr == std::end(buffer));
+      REQUIRE(std::string_view(buffer, ptr - buffer) == "{47183823-2574-4BFD-B411-99ED177D3E43}");
+   }
+
+   {
+      wchar_t buffer[32];
+      auto [ptr, ec] = uuids::to_chars(std::begin(buffer), std::end(buffer), id, uuid_format::compact);
+      REQUIRE(ec == std::errc{});
+      REQUIRE(std::wstring_view(buffer, ptr - buffer) == L"4718382325744bfdb41199ed177d3e43");
+   }
+
+   {
+      char16_t buffer[45];
+      auto [ptr, ec] = uuids::to_chars(std::begin(buffer), std::end(buffer), id, uuid_format::urn);
+      REQUIRE(ec == std::errc{});
+      REQUIRE(std::u16string_view(buffer, ptr - buffer) == u"urn:uuid:47183823-2574-4bfd-b411-99ed177d3e43");
+   }
+
+   {
+      char buffer[37] = "unchanged";
+      auto [ptr, ec] = uuids::to_chars(std::begin(buffer), std::end(buffer), id, uuid_format::braced);
+      REQUIRE(ec == std::errc::value_too_large);
+      REQUIRE(ptr == std::end(buffer));
+      REQUIRE(std::string_view(buffer) == "unchanged");
+   }
+
+   for (auto format : { uuid_format::canonical, uuid_format::braced, uuid_format::compact, uuid_format::urn })
+   {
+      char buffer[45];
+      auto [ptr, ec] = uuids::to_chars(std::begin(buffer), std::end(buffer), id, format, uuid_case::upper);
+      REQUIRE(ec == std::errc{});
+      auto str = std::string_view(buffer, ptr - buffer);
+      REQUIRE(uuids::detect_format(str) == format);
+      REQUIRE(uuids::uuid::from_string(str) == id);
+   }
+}
+
 TEST_CASE("Test is_valid_uuid(char*)", "[parse]")
 {
    REQUIRE(uuids::uuid::is_valid_uuid("47183823-2574-4bfd-b411-99ed177d3e43"));
@@ -354,6 +603,109 @@ TEST_CASE("Test constexpr from_string", "[const]")
    static_assert(value.version() != uuid_version::none);
 }
 
+TEST_CASE("Test from_string canonical layout", "[parse]")
+{
+   constexpr uuid braced = uuid::from_string("{47183823-2574-4BFD-b411-99ED177d3e43}").value();
+   static_assert(braced.version() == uuid_version::random_number_based);
+   REQUIRE(uuids::to_string(braced) == "47183823-2574-4bfd-b411-99ed177d3e43");
+
+   REQUIRE(uuids::uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43") ==
+           uuids::uuid::from_string("4718-3823-2574-4bfd-b411-99ed-177d-3e43"));
+
+   REQUIRE(!uuids::uuid::from_string("47183823-2574-4bfd-b411-99ed177d3eg3").has_value());
+   REQUIRE(!uuids::uuid::from_string("4718382x-2574-4bfd-b411-99ed177d3e43").has_value());
+   REQUIRE(!uuids::uuid::from_string(L"{47183823-2574-4bfd-b411-99ed177d3e4 }").has_value());
+   REQUIRE(!uuids::uuid::is_valid_uuid("47183823-2574-4bfd-b411-99ed177d3e4-"));
+   REQUIRE(!uuids::uuid::is_valid_uuid("47183823-2574-4bfd-b411-99ed177d3e4:"));
+}
+
+TEST_CASE("Test from_string character range", "[parse]")
+{
+   using namespace std::string_literals;
+
+   constexpr uuid value = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   REQUIRE(uuid::from_string(u"47183823-2574-4BFD-b411-99ed177d3e43") == value);
+   REQUIRE(uuid::from_string(U"{47183823-2574-4bfd-B411-99ed177d3e43}") == value);
+   REQUIRE(uuid::from_string(U"4718382325744bfdb41199ed177d3e43") == value);
+
+   // characters whose low byte is a hex digit
+   REQUIRE(!uuid::from_string(L"47183823-2574-4bfd-b411-99ed177d3e4\u0133").has_value());
+   REQUIRE(!uuid::from_string(u"47183823-2574-4bfd-b411-99ed177d3e\u0134\u0133").has_value());
+   REQUIRE(!uuid::from_string(U"47183823-2574-4bfd-b411-99ed177d3e4\U00010033").has_value());
+   REQUIRE(!uuid::is_valid_uuid(L"4718382325744bfdb41199ed177d3e4\u0133"s));
+
+   // characters outside the ASCII range
+   REQUIRE(!uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e4\xB3").has_value());
+   REQUIRE(!uuid::from_string("4718382325744bfdb41199ed177d3e4\xE3").has_value());
+}
+
+TEST_CASE("Test detect_format", "[parse]")
+{
+   using namespace std::string_literals;
+
+   static_assert(uuids::detect_format("47183823-2574-4bfd-b411-99ed177d3e43") == uuid_format::canonical);
+   REQUIRE(uuids::detect_format("{47183823-2574-4bfd-b411-99ed177d3e43}"s) == uuid_format::braced);
+   REQUIRE(uuids::detect_format(L"4718382325744bfdb41199ed177d3e43") == uuid_format::compact);
+   REQUIRE(uuids::detect_format("urn:uuid:47183823-2574-4bfd-b411-99ed177d3e43") == uuid_format::urn);
+   REQUIRE(!uuids::detect_format("").has_value());
+   REQUIRE(!uuids::detect_format("[47183823-2574-4bfd-b411-99ed177d3e43]").has_value());
+   REQUIRE(!uuids::detect_format("47183823-2574-4bfd-b411-99ed177d3e4").has_value());
+}
+
+TEST_CASE("Test from_string(urn)", "[parse]")
+{
+   using namespace std::string_view_literals;
+
+   constexpr uuid value = uuid::from_string("urn:uuid:47183823-2574-4bfd-b411-99ed177d3e43").value();
+   REQUIRE(value == uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value());
+
+   REQUIRE(uuid::from_string(L"URN:UUID:47183823-2574-4bfd-b411-99ed177d3e43") == value);
+   REQUIRE(uuid::from_string(u"Urn:Uuid:47183823-2574-4bfd-b411-99ed177d3e43"sv) == value);
+   REQUIRE(uuid::is_valid_uuid("urn:uuid:47183823-2574-4bfd-b411-99ed177d3e43"));
+
+   REQUIRE(!uuid::from_string("urn:uuid:47183823-2574-4bfd-b411-99ed177d3e4").has_value());
+   REQUIRE(!uuid::from_string("urn:uuid:{47183823-2574-4bfd-b411-99ed177d3e43}").has_value());
+   REQUIRE(!uuid::from_string("urn:uuid:4718-3823-2574-4bfd-b411-99ed177d3e43").has_value());
+   REQUIRE(!uuid::from_string("urn:uuid:47183823-2574-4bfd-b411-99ed177d3g43").has_value());
+   REQUIRE(!uuid::from_string("urn-uuid:47183823-2574-4bfd-b411-99ed177d3e43").has_value());
+   REQUIRE(!uuid::from_string("uri:uuid:47183823-2574-4bfd-b411-99ed177d3e43").has_value());
+   REQUIRE(!uuid::from_string("urn:uuid:4718382325744bfdb41199ed177d3e43").has_value());
+   REQUIRE(!uuid::from_string("4718382325744bfdb41199ed177d3e4-").has_value());
+
+   {
+      auto str = "urn:uuid:47183823-2574-4bfd-b411-99ed177d3e43\""sv;
+      uuid id;
+      auto [ptr, ec] = uuids::from_chars(str.data(), str.data() + str.size(), id);
+      REQUIRE(ec == std::errc{});
+      REQUIRE(ptr == str.data() + 45);
+      REQUIRE(id == value);
+   }
+}
+
+TEST_CASE("Test from_string_strict", "[parse]")
+{
+   using namespace std::string_literals;
+   using namespace std::string_view_literals;
+
+   constexpr uuid value = uuid::from_string_strict("47183823-2574-4bfd-b411-99ed177d3e43").value();
+   static_assert(value.version() == uuid_version::random_number_based);
+   static_assert(uuid::is_valid_uuid_strict("{47183823-2574-4bfd-b411-99ed177d3e43}"));
+
+   REQUIRE(uuid::from_string_strict("{47183823-2574-4bfd-b411-99ed177d3e43}"s) == value);
+   REQUIRE(uuid::from_string_strict(L"47183823-2574-4bfd-b411-99ed177d3e43"sv) == value);
+   REQUIRE(uuid::is_valid_uuid_strict(L"{47183823-2574-4bfd-b411-99ed177d3e43}"));
+
+   REQUIRE(!uuid::from_string_strict("4718382325744bfdb41199ed177d3e43").has_value());
+   REQUIRE(!uuid::from_string_strict("4718-3823-2574-4bfd-b411-99ed-177d-3e43").has_value());
+   REQUIRE(!uuid::from_string_strict("47183823-25744-bfd-b411-99ed177d3e43").has_value());
+   REQUIRE(!uuid::from_string_strict("{47183823-2574-4bfd-b411-99ed177d3e43").has_value());
+   REQUIRE(!uuid::from_string_strict("47183823-2574-4bfd-b411-99ed177d3e4g").has_value());
+   REQUIRE(!uuid::from_string_strict("").has_value());
+   REQUIRE(!uuid::is_valid_uuid_strict("0-1-2-3-4-5-6-7-8-9-a-b-c-d-e-f-0-1-2-3-4-5-6-7-8-9-a-b-c-d-e-f"));
+   REQUIRE(!uuid::is_valid_uuid_strict("4718382325744bfdb41199ed177d3e43"sv));
+}
+
 TEST_CASE("Test from_string(char*) invalid format", "[parse]")
 {
    REQUIRE(!uuids::uuid::from_string("").has_value());
@@ -411,6 +763,457 @@ TEST_CASE("Test from_string(basic_string_view) invalid format", "[parse]")
    REQUIRE(!uuids::uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43}"sv).has_value());
 }
 
+TEST_CASE("Test from_chars", "[parse]")
+{
+   using namespace std::string_view_literals;
+
+   constexpr uuid expected = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   {
+      auto str = "47183823-2574-4bfd-b411-99ed177d3e43\", \"next\""sv;
+      uuid id;
+      auto [ptr, ec] = uuids::from_chars(str.data(), str.data() + str.size(), id);
+      REQUIRE(ec == std::errc{});
+      REQUIRE(ptr == str.data() + 36);
+      REQUIRE(id == expected);
+   }
+
+   {
+      auto str = L"{47183823-2574-4bfd-b411-99ed177d3e43}}"sv;
+      uuid id;
+      auto [ptr, ec] = uuids::from_chars(str.data(), str.data() + str.size(), id);
+      REQUIRE(ec == std::errc{});
+      REQUIRE(ptr == str.data() + 38);
+      REQUIRE(id == expected);
+   }
+
+   {
+      auto str = "4718382325744bfdb41199ed177d3e43ff"sv;
+      uuid id;
+      auto [ptr, ec] = uuids::from_chars(str.data(), str.data() + str.size(), id);
+      REQUIRE(ec == std::errc{});
+      REQUIRE(ptr == str.data() + 32);
+      REQUIRE(id == expected);
+   }
+
+   for (auto str : {
+      ""sv,
+      "47183823-2574-4bfd-b411-99ed177d3e4"sv,
+      "47183823-2574-4bfd-b411-99ed177d3e4x"sv,
+      "4718-3823-2574-4bfd-b411-99ed-177d-3e43"sv,
+      "{47183823-2574-4bfd-b411-99ed177d3e43]"sv,
+      "{4718382325744bfdb41199ed177d3e43}"sv,
+      "4718382325744bfdb41199ed177d3e4"sv })
+   {
+      uuid id = expected;
+      auto [ptr, ec] = uuids::from_chars(str.data(), str.data() + str.size(), id);
+      REQUIRE(ec == std::errc::invalid_argument);
+      REQUIRE(ptr == str.data());
+      REQUIRE(id == expected);
+   }
+
+   {
+      constexpr auto str = "47183823-2574-4bfd-b411-99ed177d3e43"sv;
+      constexpr auto id = [str]() {
+         uuid result;
+         uuids::from_chars(str.data(), str.data() + str.size(), result);
+         return result;
+      }();
+      static_assert(id.version() == uuid_version::random_number_based);
+      REQUIRE(id == expected);
+   }
+}
+
+TEST_CASE("Test uuid_incremental_parser", "[parse]")
+{
+   using namespace std::string_view_literals;
+   using status = uuids::uuid_incremental_parser::status;
+
+   auto const expected = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   {
+      uuids::uuid_incremental_parser parser;
+      REQUIRE(parser.feed("4718"sv) == 4);
+      REQUIRE(parser.state() == status::incomplete);
+      REQUIRE(!parser.result().has_value());
+      REQUIRE(parser.feed("3823-2574-4b"sv) == 12);
+      REQUIRE(parser.feed(""sv) == 0);
+      REQUIRE(parser.feed("f"sv) == 1);
+      REQUIRE(parser.feed("d-b411-99ed177d3e43\r\n"sv) == 19);
+      REQUIRE(parser.state() == status::complete);
+      REQUIRE(parser.result() == expected);
+
+      parser.reset();
+      REQUIRE(parser.state() == status::incomplete);
+      REQUIRE(parser.feed(L"{4718382325744bfdb4"sv) == 19);
+      REQUIRE(parser.feed(L"1199ed177d3e43"sv) == 14);
+      REQUIRE(parser.state() == status::incomplete);
+      REQUIRE(parser.feed(L"},"sv) == 1);
+      REQUIRE(parser.result() == expected);
+   }
+
+   {
+      uuids::uuid_incremental_parser parser;
+      REQUIRE(parser.feed("47183823-25"sv) == 11);
+      REQUIRE(parser.feed("7x4-4bfd"sv) == 1);
+      REQUIRE(parser.state() == status::invalid);
+      REQUIRE(parser.feed("4-4bfd"sv) == 0);
+      REQUIRE(!parser.result().has_value());
+   }
+
+   {
+      uuids::uuid_incremental_parser parser;
+      REQUIRE(parser.feed("-{4718"sv) == 1);
+      REQUIRE(parser.state() == status::invalid);
+   }
+
+   {
+      // hyphens are also accepted before the closing brace, as in from_string
+      constexpr auto str = "{-4718382325744bfdb41199ed177d3e43-}"sv;
+      REQUIRE(uuid::from_string(str) == expected);
+
+      uuids::uuid_incremental_parser parser;
+      REQUIRE(parser.feed(str.substr(0, 34)) == 34);
+      REQUIRE(parser.state() == status::incomplete);
+      REQUIRE(parser.feed(str.substr(34)) == 2);
+      REQUIRE(parser.state() == status::complete);
+      REQUIRE(parser.result() == expected);
+
+      parser.reset();
+      REQUIRE(parser.feed("{4718382325744bfdb41199ed177d3e43-x}"sv) == 34);
+      REQUIRE(parser.state() == status::invalid);
+   }
+
+   {
+      constexpr auto id = []() {
+         uuids::uuid_incremental_parser parser;
+         parser.feed("47183823-2574-4bfd");
+         parser.feed("-b411-99ed177d3e43");
+         return parser.result().value();
+      }();
+      static_assert(id.version() == uuid_version::random_number_based);
+      REQUIRE(id == expected);
+   }
+}
+
+TEST_CASE("Test parse_many", "[parse]")
+{
+   std::vector<std::string> strs;
+   for (int i = 0; i < 70; ++i)
+   {
+      strs.push_back(i % 3 == 0 ?
+         "47183823-2574-4bfd-b411-99ed177d3e" + std::to_string(10 + i) :
+         "47183823-2574-4bfd-b411-99ed177d3e4");
+   }
+   std::vector<std::string_view> views(std::begin(strs), std::end(strs));
+
+   std::vector<uuid> ids(views.size());
+   std::vector<uint64_t> valid(2);
+
+   auto count = uuids::parse_many(
+      uuids::span<std::string_view const, uuids::dynamic_extent>{ views },
+      uuids::span<uuid, uuids::dynamic_extent>{ ids },
+      uuids::span<uint64_t, uuids::dynamic_extent>{ valid });
+
+   REQUIRE(count == 24);
+   for (size_t i = 0; i < views.size(); ++i)
+   {
+      bool const is_valid = (valid[i / 64] >> (i % 64)) & 1;
+      REQUIRE(is_valid == (i % 3 == 0));
+      REQUIRE(ids[i] == uuids::uuid::from_string(views[i]).value_or(uuid{}));
+   }
+
+   std::vector<uint64_t> short_mask(1);
+   count = uuids::parse_many(
+      uuids::span<std::string const, uuids::dynamic_extent>{ strs },
+      uuids::span<uuid, uuids::dynamic_extent>{ ids },
+      uuids::span<uint64_t, uuids::dynamic_extent>{ short_mask });
+   REQUIRE(count == 22);
+
+#ifdef UUID_PARALLEL_ALGORITHMS
+   std::vector<uuid> par_ids(views.size());
+   std::vector<uint64_t> par_valid(2);
+   count = uuids::parse_many(std::execution::seq,
+      uuids::span<std::string_view const, uuids::dynamic_extent>{ views },
+      uuids::span<uuid, uuids::dynamic_extent>{ par_ids },
+      uuids::span<uint64_t, uuids::dynamic_extent>{ par_valid });
+   REQUIRE(count == 24);
+   REQUIRE(par_ids == ids);
+   REQUIRE(par_valid == valid);
+#endif
+}
+
+TEST_CASE("Test scan_uuids", "[parse]")
+{
+   using namespace std::string_view_literals;
+
+   auto buffer =
+      "47183823-2574-4bfd-b411-99ed177d3e43\n"
+      "{fea43102-064f-4444-adc2-02cec42623f8}\r\n"
+      "bad\n"
+      "\n"
+      "4718382325744bfdb41199ed177d3e43,"
+      "47183823-2574-4bfd-b411-99ed177d3e4\n"
+      "00000000-0000-0000-0000-000000000000"sv;
+
+   std::vector<uuid> ids;
+   std::vector<std::pair<size_t, std::string_view>> errors;
+   auto count = uuids::scan_uuids(buffer,
+      [&](uuid const & id) { ids.push_back(id); },
+      [&](size_t offset, std::string_view field) { errors.emplace_back(offset, field); });
+
+   REQUIRE(count == 4);
+   REQUIRE(ids.size() == 4);
+   REQUIRE(uuids::to_string(ids[0]) == "47183823-2574-4bfd-b411-99ed177d3e43");
+   REQUIRE(uuids::to_string(ids[1]) == "fea43102-064f-4444-adc2-02cec42623f8");
+   REQUIRE(ids[2] == ids[0]);
+   REQUIRE(ids[3].is_nil());
+
+   REQUIRE(errors.size() == 2);
+   REQUIRE(errors[0].first == 77);
+   REQUIRE(errors[0].second == "bad");
+   REQUIRE(errors[1].first == 115);
+   REQUIRE(errors[1].second == "47183823-2574-4bfd-b411-99ed177d3e4");
+
+   // a short record followed by one that places a delimiter at the canonical offset
+   count = uuids::scan_uuids(L"bad\n47183823-2574-4bfd-b411-99ed177d3e\n"sv,
+      [&](uuid const &) {},
+      [&](size_t, std::wstring_view) {});
+   REQUIRE(count == 0);
+
+   errors.clear();
+   count = uuids::scan_uuids("x\n47183823-2574-4bfd-b411-99ed177d3e4\n47183823-2574-4bfd-b411-99ed177d3e43\n",
+      [&](uuid const &) {},
+      [&](size_t offset, std::string_view field) { errors.emplace_back(offset, field); });
+   REQUIRE(count == 1);
+   REQUIRE(errors.size() == 2);
+   REQUIRE(errors[0].first == 0);
+   REQUIRE(errors[1].first == 2);
+}
+
+TEST_CASE("Test stream insertion", "[ops]")
+{
+   auto id = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   {
+      std::ostringstream os;
+      os << id << ',' << std::uppercase << id;
+      REQUIRE(os.str() == "47183823-2574-4bfd-b411-99ed177d3e43,47183823-2574-4BFD-B411-99ED177D3E43");
+   }
+
+   {
+      std::ostringstream os;
+      os << std::setw(40) << std::setfill('*') << id << '|' << id;
+      REQUIRE(os.str() == "****47183823-2574-4bfd-b411-99ed177d3e43|47183823-2574-4bfd-b411-99ed177d3e43");
+      REQUIRE(os.width() == 0);
+   }
+
+   {
+      std::wostringstream os;
+      os << std::left << std::setw(38) << std::setfill(L'.') << id << L'|' << std::setw(10) << id;
+      REQUIRE(os.str() == L"47183823-2574-4bfd-b411-99ed177d3e43..|47183823-2574-4bfd-b411-99ed177d3e43");
+   }
+
+   {
+      std::ostringstream os;
+      os.setstate(std::ios_base::failbit);
+      os << id;
+      REQUIRE(os.str().empty());
+   }
+}
+
+TEST_CASE("Test stream extraction", "[parse]")
+{
+   auto const expected = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   {
+      std::istringstream stream(
+         "47183823-2574-4bfd-b411-99ed177d3e43\n"
+         "  {47183823-2574-4bfd-b411-99ed177d3e43}x"
+         "4718382325744bfdb41199ed177d3e43 "
+         "urn:uuid:47183823-2574-4bfd-b411-99ed177d3e43");
+
+      for (int i = 0; i < 4; ++i)
+      {
+         uuid id;
+         REQUIRE(stream >> id);
+         REQUIRE(id == expected);
+         if (i == 1)
+         {
+            REQUIRE(stream.get() == 'x');
+         }
+      }
+
+      uuid id;
+      REQUIRE(!(stream >> id));
+      REQUIRE(stream.eof());
+   }
+
+   {
+      std::wistringstream stream(L"47183823-2574-4bfd-b411-99ed177d3e43,fea43102-064f-4444-adc2-02cec42623f8");
+      uuid id1, id2;
+      wchar_t comma;
+      REQUIRE(stream >> id1 >> comma >> id2);
+      REQUIRE(id1 == expected);
+      REQUIRE(comma == L',');
+      REQUIRE(uuids::to_string(id2) == "fea43102-064f-4444-adc2-02cec42623f8");
+   }
+
+   {
+      // a closing brace only belongs to the uuid if it started with an opening one
+      std::istringstream stream("{\"id\":47183823-2574-4bfd-b411-99ed177d3e43}");
+      stream.ignore(6);
+      uuid id;
+      REQUIRE(stream >> id);
+      REQUIRE(id == expected);
+      REQUIRE(stream.get() == '}');
+   }
+
+   for (auto str : { "", "  ", "47183823-2574-4bfd-b411-99ed177d3e4", "47183823-2574-4bfd-b411-99ed177d3e43a",
+                     "urn:uid:47183823-2574-4bfd-b411-99ed177d3e43", "g7183823-2574-4bfd-b411-99ed177d3e43" })
+   {
+      std::istringstream stream(str);
+      uuid id = expected;
+      REQUIRE(!(stream >> id));
+      REQUIRE(id == expected);
+   }
+}
+
+TEST_CASE("Test format_many", "[ops]")
+{
+   std::vector<uuid> ids{
+      uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value(),
+      uuid{},
+      uuid::from_string("fea43102-064f-4444-adc2-02cec42623f8").value() };
+
+   {
+      std::string buffer(3 * 36, ' ');
+      auto [ptr, ec] = uuids::format_many(ids, buffer.data(), buffer.data() + buffer.size());
+      REQUIRE(ec == std::errc{});
+      REQUIRE(ptr == buffer.data() + buffer.size());
+      REQUIRE(buffer ==
+         "47183823-2574-4bfd-b411-99ed177d3e43"
+         "00000000-0000-0000-0000-000000000000"
+         "fea43102-064f-4444-adc2-02cec42623f8");
+   }
+
+   std::wstring const expected =
+      L"47183823-2574-4bfd-b411-99ed177d3e43\n"
+      L"00000000-0000-0000-0000-000000000000\n"
+      L"fea43102-064f-4444-adc2-02cec42623f8";
+
+   {
+      std::wstring buffer(200, L' ');
+      auto [ptr, ec] = uuids::format_many(ids, buffer.data(), buffer.data() + buffer.size(), L'\n');
+      REQUIRE(ec == std::errc{});
+      REQUIRE(std::wstring(buffer.data(), ptr) == expected);
+   }
+
+   {
+      std::wstring buffer(3 * 37 - 2, L' ');
+      auto [ptr, ec] = uuids::format_many(ids, buffer.data(), buffer.data() + buffer.size(), L'\n');
+      REQUIRE(ec == std::errc::value_too_large);
+      REQUIRE(ptr == buffer.data() + buffer.size());
+      REQUIRE(buffer == std::wstring(3 * 37 - 2, L' '));
+   }
+
+   {
+      char buffer[1];
+      auto [ptr, ec] = uuids::format_many(uuids::span<uuid const, uuids::dynamic_extent>{}, buffer, buffer, ',');
+      REQUIRE(ec == std::errc{});
+      REQUIRE(ptr == buffer);
+   }
+
+#ifdef UUID_PARALLEL_ALGORITHMS
+   {
+      std::wstring buffer(3 * 37 - 1, L' ');
+      auto [ptr, ec] = uuids::format_many(std::execution::seq, ids, buffer.data(), buffer.data() + buffer.size(), L'\n');
+      REQUIRE(ec == std::errc{});
+      REQUIRE(ptr == buffer.data() + buffer.size());
+      REQUIRE(buffer == expected);
+   }
+#endif
+}
+
+TEST_CASE("Test compact text encodings", "[ops]")
+{
+   constexpr uuid id = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+   constexpr uuid max = uuid::from_string("ffffffff-ffff-ffff-ffff-ffffffffffff").value();
+
+   SECTION("base64url")
+   {
+      static_assert(uuids::to_base64url(id).view() == "Rxg4IyV0S_20EZntF30-Qw");
+      REQUIRE(uuids::to_base64url(uuid{}).view() == "AAAAAAAAAAAAAAAAAAAAAA");
+      REQUIRE(uuids::to_base64url(max).view() == "_____________________w");
+      REQUIRE(uuids::to_base64url<wchar_t>(id).view() == L"Rxg4IyV0S_20EZntF30-Qw");
+
+      static_assert(uuids::to_fixed_string(uuids::from_base64url("Rxg4IyV0S_20EZntF30-Qw").value()).view() == "47183823-2574-4bfd-b411-99ed177d3e43");
+      REQUIRE(uuids::from_base64url("Rxg4IyV0S_20EZntF30-Qw").value() == id);
+      REQUIRE(uuids::from_base64url(L"_____________________w").value() == max);
+      REQUIRE(!uuids::from_base64url("Rxg4IyV0S_20EZntF30-Qx").has_value());
+      REQUIRE(!uuids::from_base64url("Rxg4IyV0S/20EZntF30+Qw").has_value());
+      REQUIRE(!uuids::from_base64url("Rxg4IyV0S_20EZntF30-Q").has_value());
+      REQUIRE(!uuids::from_base64url("Rxg4IyV0S_20EZntF30-Qw==").has_value());
+   }
+
+   SECTION("base32")
+   {
+      static_assert(uuids::to_base32(id).view() == "2730W269BM9FYV84CSXMBQTFJ3");
+      REQUIRE(uuids::to_base32(uuid{}).view() == "00000000000000000000000000");
+      REQUIRE(uuids::to_base32(max).view() == "7ZZZZZZZZZZZZZZZZZZZZZZZZZ");
+
+      static_assert(uuids::to_fixed_string(uuids::from_base32("2730W269BM9FYV84CSXMBQTFJ3").value()).view() == "47183823-2574-4bfd-b411-99ed177d3e43");
+      REQUIRE(uuids::from_base32("2730W269BM9FYV84CSXMBQTFJ3").value() == id);
+      REQUIRE(uuids::from_base32("2730w269bm9fyv84csxmbqtfj3").value() == id);
+      REQUIRE(uuids::from_base32("OOOOOOOOOOOOOOOOOOOOOOOOOo").value() == uuid{});
+      REQUIRE(uuids::from_base32("0000000000000000000000000I") == uuids::from_base32("00000000000000000000000001"));
+      REQUIRE(!uuids::from_base32("8ZZZZZZZZZZZZZZZZZZZZZZZZZ").has_value());
+      REQUIRE(!uuids::from_base32("2730W269BM9FYV84CSXMBQTFJU").has_value());
+      REQUIRE(!uuids::from_base32("2730W269BM9FYV84CSXMBQTFJ").has_value());
+   }
+
+   SECTION("base58")
+   {
+      static_assert(uuids::to_base58(id).view() == "9nBmxFFgEFhFsgy5X1BzqG");
+      REQUIRE(uuids::to_base58(uuid{}).view() == "1111111111111111111111");
+      REQUIRE(uuids::to_base58(max).view() == "YcVfxkQb6JRzqk5kF2tNLv");
+
+      static_assert(uuids::to_fixed_string(uuids::from_base58("9nBmxFFgEFhFsgy5X1BzqG").value()).view() == "47183823-2574-4bfd-b411-99ed177d3e43");
+      REQUIRE(uuids::from_base58("9nBmxFFgEFhFsgy5X1BzqG").value() == id);
+      REQUIRE(uuids::from_base58(std::string("YcVfxkQb6JRzqk5kF2tNLv")).value() == max);
+      REQUIRE(!uuids::from_base58("YcVfxkQb6JRzqk5kF2tNLw").has_value());
+      REQUIRE(!uuids::from_base58("9nBmxFFgEFhFsgy5X1BzqO").has_value());
+      REQUIRE(!uuids::from_base58("9nBmxFFgEFhFsgy5X1Bzq").has_value());
+   }
+
+   SECTION("order")
+   {
+      std::vector<uuid> ids{ uuid{}, id, max,
+         uuid::from_string("fea43102-064f-4444-adc2-02cec42623f8").value(),
+         uuid::from_string("00000000-0000-0000-0000-0000000000ff").value() };
+      std::sort(ids.begin(), ids.end());
+
+      for (size_t i = 1; i < ids.size(); ++i)
+      {
+         REQUIRE(uuids::to_base32(ids[i - 1]).view() < uuids::to_base32(ids[i]).view());
+         REQUIRE(uuids::to_base58(ids[i - 1]).view() < uuids::to_base58(ids[i]).view());
+      }
+   }
+
+   SECTION("round trip")
+   {
+      std::mt19937 engine{ 42 };
+      uuids::uuid_random_generator gen{ engine };
+      for (int i = 0; i < 1000; ++i)
+      {
+         uuid const value = gen();
+         REQUIRE(uuids::from_base64url(uuids::to_base64url(value).view()).value() == value);
+         REQUIRE(uuids::from_base32(uuids::to_base32(value).view()).value() == value);
+         REQUIRE(uuids::from_base58(uuids::to_base58(value).view()).value() == value);
+      }
+   }
+}
+
 TEST_CASE("Test iterators constructor", "[ctors]")
 {
    using namespace std::string_literals;
@@ -517,6 +1320,44 @@ TEST_CASE("Test comparison", "[operators]")
    REQUIRE(ids.find(uuid{}) != ids.end());
 }
 
+TEST_CASE("Test comparison matches octet order", "[operators]")
+{
+   std::mt19937 engine{ 7 };
+   std::uniform_int_distribution<int> octet{ 0, 255 };
+
+   std::vector<std::array<uuids::uuid::value_type, 16>> values;
+   for (int i = 0; i < 64; ++i)
+   {
+      std::array<uuids::uuid::value_type, 16> arr{};
+      for (auto & b : arr)
+         b = static_cast<uuids::uuid::value_type>(octet(engine) & 0x03);
+      values.push_back(arr);
+   }
+   for (size_t i = 0; i < 16; ++i)
+   {
+      std::array<uuids::uuid::value_type, 16> arr{};
+      arr[i] = 0x80;
+      values.push_back(arr);
+      arr[i] = 0x01;
+      values.push_back(arr);
+   }
+
+   for (auto const & a : values)
+   {
+      for (auto const & b : values)
+      {
+         uuid const lhs{ a };
+         uuid const rhs{ b };
+         REQUIRE((lhs == rhs) == (a == b));
+         REQUIRE((lhs != rhs) == (a != b));
+         REQUIRE((lhs < rhs) == (a < b));
+#ifdef __cpp_lib_three_way_comparison
+         REQUIRE((lhs <=> rhs) == (a <=> b));
+#endif
+      }
+   }
+}
+
 TEST_CASE("Test hashing", "[ops]")
 {
    using namespace std::string_literals;
@@ -547,6 +1388,195 @@ TEST_CASE("Test hashing", "[ops]")
    REQUIRE(ids.find(uuid{}) != ids.end());
 }
 
+namespace
+{
+   template <typename Hasher>
+   double worst_avalanche_bias(Hasher hasher)
+   {
+      std::mt19937 engine{ 11 };
+      uuids::uuid_random_generator gen{ engine };
+
+      constexpr int samples = 2000;
+      std::vector<int> flips(128 * 64, 0);
+      for (int i = 0; i < samples; ++i)
+      {
+         auto const id = gen();
+         auto const bytes = id.as_bytes();
+         std::array<uuids::uuid::value_type, 16> data;
+         std::memcpy(data.data(), bytes.data(), 16);
+
+         uint64_t const h = hasher(id);
+         for (size_t bit = 0; bit < 128; ++bit)
+         {
+            auto flipped = data;
+            flipped[bit / 8] = static_cast<uuids::uuid::value_type>(flipped[bit / 8] ^ (1u << (bit % 8)));
+            uint64_t const diff = h ^ static_cast<uint64_t>(hasher(uuid{ flipped }));
+            for (size_t out = 0; out < 64; ++out)
+               flips[bit * 64 + out] += static_cast<int>((diff >> out) & 1);
+         }
+      }
+
+      double worst = 0;
+      for (int count : flips)
+         worst = std::max(worst, std::abs(count / double(samples) - 0.5));
+      return worst;
+   }
+
+   // the most uuids that fall in the same bucket of a table with a power-of-two number of buckets, for uuids that only
+   // differ in a counter stored in the given octets, as in time-based or sequential ids
+   template <typename Hasher>
+   size_t worst_bucket_load(Hasher hasher, size_t first_octet)
+   {
+      constexpr size_t count = 1 << 14;
+      constexpr size_t buckets = 1 << 12;
+      std::vector<size_t> loads(buckets, 0);
+      for (size_t i = 0; i < count; ++i)
+      {
+         std::array<uuids::uuid::value_type, 16> data{ {
+            0x47, 0x18, 0x38, 0x23, 0x25, 0x74, 0x1b, 0xfd,
+            0xb4, 0x11, 0x99, 0xed, 0x17, 0x7d, 0x3e, 0x43 } };
+         data[first_octet] = static_cast<uuids::uuid::value_type>(i >> 8);
+         data[first_octet + 1] = static_cast<uuids::uuid::value_type>(i);
+         ++loads[static_cast<uint64_t>(hasher(uuid{ data })) & (buckets - 1)];
+      }
+      return *std::max_element(loads.begin(), loads.end());
+   }
+}
+
+TEST_CASE("Test hash functors", "[ops]")
+{
+   auto id = uuids::uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   SECTION("string_uuid_hash")
+   {
+      REQUIRE(uuids::string_uuid_hash{}(id) == std::hash<std::string>{}(uuids::to_string(id)));
+      REQUIRE(uuids::string_uuid_hash{}(uuid{}) == std::hash<std::string>{}(uuids::to_string(uuid{})));
+   }
+
+   SECTION("xxh3_uuid_hash")
+   {
+      // XXH3_64bits of the 16 octets, with the default secret and seed
+      static_assert(uuids::xxh3_uuid_hash{}(uuid{}) == static_cast<size_t>(0xD0A66A65C7528968ull));
+      REQUIRE(uuids::xxh3_uuid_hash{}(id) == static_cast<size_t>(0x21734F6CABE0AC6Bull));
+   }
+
+   SECTION("avalanche")
+   {
+      REQUIRE(worst_avalanche_bias(uuids::fast_uuid_hash{}) < 0.1);
+      REQUIRE(worst_avalanche_bias(uuids::xxh3_uuid_hash{}) < 0.1);
+   }
+
+   SECTION("bucket distribution")
+   {
+      // 16384 uuids in 4096 buckets: 4 per bucket on average, rarely more than 15 in any bucket
+      for (size_t first_octet : { 0, 2, 4, 6, 10, 14 })
+      {
+         REQUIRE(worst_bucket_load(uuids::fast_uuid_hash{}, first_octet) <= 24);
+         REQUIRE(worst_bucket_load(uuids::xxh3_uuid_hash{}, first_octet) <= 24);
+         REQUIRE(worst_bucket_load(uuids::string_uuid_hash{}, first_octet) <= 24);
+      }
+
+#ifndef UUID_HASH_STRING_BASED
+      // the default hash only folds the two halves, so a counter in the high octets of a half leaves the low bits
+      // of the hash unchanged
+      REQUIRE(worst_bucket_load(std::hash<uuid>{}, 2) > 24);
+#endif
+   }
+
+   std::unordered_set<uuid, uuids::fast_uuid_hash> ids{ uuid{}, id };
+   REQUIRE(ids.size() == 2);
+   REQUIRE(ids.count(id) == 1);
+}
+
+TEST_CASE("Test keyed_uuid_hash", "[ops]")
+{
+   constexpr uuid id = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+
+   // SipHash-1-3 of the 16 octets
+   constexpr uuids::keyed_uuid_hash zero_key{ { 0, 0 } };
+   static_assert(zero_key(id) == static_cast<size_t>(0x946EDDFE1F00E822ull));
+   static_assert(zero_key(uuid{}) == static_cast<size_t>(0x76BE999E3E25B2A0ull));
+
+   constexpr uuids::keyed_uuid_hash keyed{ { 0x0706050403020100ull, 0x0F0E0D0C0B0A0908ull } };
+   REQUIRE(keyed(id) == static_cast<size_t>(0x987C722671217738ull));
+   REQUIRE(keyed(uuid{}) == static_cast<size_t>(0x403E4B0D4F19F787ull));
+
+   uuids::keyed_uuid_hash first;
+   uuids::keyed_uuid_hash second;
+   REQUIRE(first.key() == second.key());
+   REQUIRE(first(id) == second(id));
+   REQUIRE(first.key() != zero_key.key());
+
+   REQUIRE(worst_avalanche_bias(first) < 0.1);
+   for (size_t first_octet : { 0, 2, 6, 14 })
+      REQUIRE(worst_bucket_load(first, first_octet) <= 24);
+
+   std::unordered_set<uuid, uuids::keyed_uuid_hash> ids{ uuid{}, id };
+   REQUIRE(ids.size() == 2);
+   REQUIRE(ids.count(id) == 1);
+}
+
+TEST_CASE("Test random_uuid_hash", "[ops]")
+{
+   constexpr uuid id = uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value();
+   static_assert(uuids::random_uuid_hash{}(id) == static_cast<size_t>(0xFD4B742523381847ull));
+
+   std::mt19937 engine{ 5 };
+   uuids::uuid_random_generator gen{ engine };
+
+   constexpr size_t buckets = 1 << 12;
+   std::vector<size_t> loads(buckets, 0);
+   std::unordered_set<uuid, uuids::random_uuid_hash> ids;
+   for (size_t i = 0; i < 4 * buckets; ++i)
+   {
+      auto const value = gen();
+      ++loads[uuids::random_uuid_hash{}(value) & (buckets - 1)];
+      ids.insert(value);
+   }
+
+   REQUIRE(*std::max_element(loads.begin(), loads.end()) <= 24);
+   REQUIRE(ids.size() == 4 * buckets);
+}
+
+TEST_CASE("Test hash_many", "[ops]")
+{
+   std::mt19937 engine{ 3 };
+   uuids::uuid_random_generator gen{ engine };
+
+   std::vector<uuid> ids{ uuid{}, uuid::from_string("47183823-2574-4bfd-b411-99ed177d3e43").value() };
+   for (int i = 0; i < 100; ++i)
+      ids.push_back(gen());
+
+   auto const check = [&](auto hasher) {
+      std::vector<uint64_t> hashes(ids.size() + 1, 0);
+      REQUIRE(uuids::hash_many(ids, hashes, hasher) == ids.size());
+      for (size_t i = 0; i < ids.size(); ++i)
+         REQUIRE(hashes[i] == static_cast<uint64_t>(hasher(ids[i])));
+      REQUIRE(hashes.back() == 0);
+   };
+
+   check(std::hash<uuid>{});
+   check(uuids::fast_uuid_hash{});
+   check(uuids::xxh3_uuid_hash{});
+   check(uuids::keyed_uuid_hash{});
+
+   std::vector<uint64_t> hashes(10, 0);
+   REQUIRE(uuids::hash_many(ids, hashes) == 10);
+#ifndef UUID_HASH_STRING_BASED
+   REQUIRE(hashes[1] == static_cast<uint64_t>(std::hash<uuid>{}(ids[1])));
+   if constexpr (sizeof(size_t) > 4)
+      REQUIRE(hashes[1] == 0xF309A1CE320975BEull);
+#endif
+
+#ifdef UUID_PARALLEL_ALGORITHMS
+   std::vector<uint64_t> parallel(ids.size(), 0);
+   std::vector<uint64_t> sequential(ids.size(), 0);
+   REQUIRE(uuids::hash_many(std::execution::seq, ids, parallel, uuids::fast_uuid_hash{}) == ids.size());
+   uuids::hash_many(ids, sequential, uuids::fast_uuid_hash{});
+   REQUIRE(parallel == sequential);
+#endif
+}
+
 TEST_CASE("Test swap", "[ops]")
 {
    uuid empty;
@@ -577,6 +1607,34 @@ TEST_CASE("Test constexpr", "[const]")
    static_assert(empty.version() == uuid_version::none);
 }
 
+TEST_CASE("Test constexpr formatting", "[const]")
+{
+   struct entry
+   {
+      uuid id;
+      uuids::uuid_string<char> text;
+   };
+
+   constexpr uuids::uuid::value_type bytes[16] {
+      0x47, 0x18, 0x38, 0x23, 0x25, 0x74, 0x4b, 0xfd,
+      0xb4, 0x11, 0x99, 0xed, 0x17, 0x7d, 0x3e, 0x43 };
+   constexpr uuid from_bytes{ bytes };
+   constexpr uuid from_text = uuid::from_string("fea43102-064f-4444-adc2-02cec42623f8").value();
+
+   constexpr entry table[] {
+      { from_bytes, uuids::to_fixed_string(from_bytes) },
+      { from_text, uuids::to_fixed_string(from_text) },
+      { uuid{}, uuids::to_fixed_string(uuid{}) } };
+
+   static_assert(table[0].text.view() == "47183823-2574-4bfd-b411-99ed177d3e43");
+   static_assert(table[1].text.view() == "fea43102-064f-4444-adc2-02cec42623f8");
+   static_assert(table[2].text.view() == "00000000-0000-0000-0000-000000000000");
+   static_assert(uuid::from_string(table[0].text.view()).value().version() == uuid_version::random_number_based);
+
+   for (auto const & e : table)
+      REQUIRE(uuids::to_string(e.id) == e.text.view());
+}
+
 TEST_CASE("Test size", "[operators]")
 {
    REQUIRE(sizeof(uuid) == 16);